@@ -24,7 +24,8 @@ namespace collision {
 static double default_model_envelope = 0.03;
 static double default_safe_margin = 0.01;
 
-ChCollisionModel::ChCollisionModel() : mcontactable(nullptr), family_group(1), family_mask(0x7FFF) {
+ChCollisionModel::ChCollisionModel()
+    : mcontactable(nullptr), family_group(1), family_mask(0x7FFF), ccd(false), ccd_radius(0) {
     model_envelope = (float)default_model_envelope;
     model_safe_margin = (float)default_safe_margin;
 }
@@ -371,6 +371,28 @@ class ChApi ChCollisionModel {
     static double GetDefaultSuggestedEnvelope();
     static double GetDefaultSuggestedMargin();
 
+    /// Enable continuous collision detection (CCD) for this model (default: false).
+    /// With CCD enabled, whenever the body owning this model would move during a step by more than the specified swept
+    /// sphere radius, a sphere of that radius, centered at the body center of mass, is swept along the displacement of
+    /// the body over the step and a speculative contact (with positive distance) is generated at the first impact with
+    /// another collision model. This prevents small, fast bodies from tunneling through thin objects, without reducing
+    /// the integration step size. The swept sphere radius should be comparable to the body size; CCD is ignored if it
+    /// is not positive.
+    /// Notes:
+    /// - CCD is currently applied to the collision models of ChBody objects only.
+    /// - speculative contacts are effective with the NSC contact method only (SMC contacts produce no force at a
+    ///   positive distance).
+    void SetCCD(bool val, double swept_sphere_radius) {
+        ccd = val;
+        ccd_radius = swept_sphere_radius;
+    }
+
+    /// Return true if continuous collision detection is enabled for this model.
+    bool GetCCD() const { return ccd; }
+
+    /// Return the swept sphere radius for continuous collision detection (see SetCCD).
+    double GetCCDSweptSphereRadius() const { return ccd_radius; }
+
     /// Return the axis aligned bounding box (AABB) of the collision model,
     /// i.e. max-min along the x,y,z world axes. Remember that SyncPosition()
     /// should be invoked before calling this.
@@ -428,6 +450,9 @@ class ChApi ChCollisionModel {
     short int family_group;  ///< Collision family group
     short int family_mask;   ///< Collision family mask
 
+    bool ccd;           ///< continuous collision detection enabled
+    double ccd_radius;  ///< swept sphere radius for continuous collision detection
+
     std::vector<std::shared_ptr<ChCollisionShape>> m_shapes;  ///< list of collision shapes in model
 };
 
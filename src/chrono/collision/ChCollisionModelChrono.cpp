@@ -348,16 +348,27 @@ bool ChCollisionModelChrono::AddTriangleMesh(std::shared_ptr<ChMaterialSurface>
     const ChVector<>& position = frame.GetPos();
     const ChQuaternion<>& rotation = frame.GetRot();
 
-    for (int i = 0; i < trimesh->getNumTriangles(); i++) {
-        auto shape = new ChCollisionShapeChrono(ChCollisionShape::Type::TRIANGLE, material);
+    int num_triangles = trimesh->getNumTriangles();
+    if (num_triangles == 0)
+        return false;
+
+    // Triangle vertices, in the mesh frame
+    std::vector<real3> vertices(3 * num_triangles);
+    for (int i = 0; i < num_triangles; i++) {
         geometry::ChTriangle temptri = trimesh->getTriangle(i);
-        shape->A = real3(temptri.p1.x() + position.x(), temptri.p1.y() + position.y(), temptri.p1.z() + position.z());
-        shape->B = real3(temptri.p2.x() + position.x(), temptri.p2.y() + position.y(), temptri.p2.z() + position.z());
-        shape->C = real3(temptri.p3.x() + position.x(), temptri.p3.y() + position.y(), temptri.p3.z() + position.z());
-        shape->R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
-        m_shapes.push_back(std::shared_ptr<ChCollisionShape>(shape));
+        vertices[3 * i + 0] = real3(temptri.p1.x(), temptri.p1.y(), temptri.p1.z());
+        vertices[3 * i + 1] = real3(temptri.p2.x(), temptri.p2.y(), temptri.p2.z());
+        vertices[3 * i + 2] = real3(temptri.p3.x(), temptri.p3.y(), temptri.p3.z());
     }
 
+    auto shape = new ChCollisionShapeChrono(ChCollisionShape::Type::TRIANGLEMESH, material);
+    shape->A = real3(position.x(), position.y(), position.z());
+    shape->B = real3(0, 0, 0);
+    shape->C = real3(0, 0, 0);
+    shape->R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
+    shape->mesh = chrono_types::make_shared<ChTriangleMeshBVH>(vertices);
+    m_shapes.push_back(std::shared_ptr<ChCollisionShape>(shape));
+
     return true;
 }
 
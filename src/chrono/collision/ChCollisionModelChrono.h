@@ -184,6 +184,9 @@ class ChApi ChCollisionModelChrono : public ChCollisionModel {
         ) override;
 
     /// Add a triangle mesh to this collision model.
+    /// The mesh is added as a single collision shape, with its triangles stored in a bounding volume hierarchy built
+    /// in the mesh frame (see ChTriangleMeshBVH). The broadphase treats the mesh as one shape, and the narrowphase only
+    /// tests the triangles overlapping the other shape of a candidate pair.
     /// Note: if possible, for better performance, avoid triangle meshes and prefer simplified
     /// representations as compounds of primitive convex shapes (boxes, sphers, etc).
     virtual bool AddTriangleMesh(                           //
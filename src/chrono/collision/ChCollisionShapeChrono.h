@@ -20,6 +20,8 @@
 #include "chrono/multicore_math/real3.h"
 #include "chrono/multicore_math/real4.h"
 
+#include "chrono/collision/chrono/ChTriangleMeshBVH.h"
+
 namespace chrono {
 namespace collision {
 
@@ -37,6 +39,8 @@ class ChCollisionShapeChrono : public ChCollisionShape {
     real3 C;        ///< extra
     quaternion R;   ///< rotation
     real3* convex;  ///< pointer to convex data;
+
+    std::shared_ptr<ChTriangleMeshBVH> mesh;  ///< triangle BVH (triangle mesh shapes only)
 };
 
 /// @} collision_mc
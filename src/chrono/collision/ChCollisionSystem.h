@@ -169,6 +169,44 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Perform a batch of ray-hit tests, with all collision models or only with the specified collision model (if not
+    /// null). The i-th ray goes from from[i] to to[i] and its result is returned in results[i].
+    /// The default implementation performs the tests sequentially, through RayHit(). Derived classes may override this
+    /// function to process the rays in parallel.
+    virtual void RayHitBatch(const std::vector<ChVector<>>& from,
+                             const std::vector<ChVector<>>& to,
+                             std::vector<ChRayhitResult>& results,
+                             ChCollisionModel* model = nullptr) const {
+        assert(from.size() == to.size());
+        results.resize(from.size());
+        for (size_t i = 0; i < from.size(); i++) {
+            if (model)
+                RayHit(from[i], to[i], model, results[i]);
+            else
+                RayHit(from[i], to[i], results[i]);
+        }
+    }
+
+    /// Recover results from SweepSphere().
+    struct ChSweephitResult : public ChRayhitResult {
+        ChCollisionShape* hitShape;  ///< pointer to intersected collision shape (may be null if not known)
+    };
+
+    /// Perform a sphere sweep test with the collision models: find the first contact of a sphere with given radius,
+    /// moving from 'from' to 'to'. The collision models which do not collide with the specified model (because of
+    /// their collision families), as well as the model itself, are ignored.
+    /// On output, the hit point is the contact point on the surface of the hit model, the hit normal points towards the
+    /// sphere, and the distance factor is the sweep parameter at the time of impact.
+    /// The default implementation reports no hit.
+    virtual bool SweepSphere(const ChVector<>& from,
+                             const ChVector<>& to,
+                             double radius,
+                             ChCollisionModel* model,
+                             ChSweephitResult& result) const {
+        result.hit = false;
+        return false;
+    }
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/collision/ChCollisionSystemBullet.h"
@@ -30,7 +32,8 @@ namespace collision {
 // dynamic creation and persistence
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet()
+    : m_debug_drawer(nullptr), m_num_threads(1), m_parallel_report(false) {
     // cbtDefaultCollisionConstructionInfo conf_info(...); ***TODO***
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
@@ -119,11 +122,16 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_num_threads = nthreads;
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
 }
 
+void ChCollisionSystemBullet::SetParallelBroadphase(bool val) {
+    bt_collision_world->setParallelAabbs(val);
+}
+
 void ChCollisionSystemBullet::Clear(void) {
     int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
     for (int i = 0; i < numManifolds; i++) {
@@ -182,86 +190,113 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
 
+    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
+
+    if (m_parallel_report && m_num_threads > 1) {
+        // Split the manifolds in contiguous ranges, processed in parallel and collecting contacts in separate batches.
+        // Adding the batches in order then preserves the order of the serial loop.
+        int num_batches = 4 * m_num_threads;
+        int batch_size = (numManifolds + num_batches - 1) / num_batches;
+        m_contact_batches.resize(num_batches);
+
+#pragma omp parallel for schedule(dynamic) num_threads(m_num_threads)
+        for (int ib = 0; ib < num_batches; ib++) {
+            m_contact_batches[ib].clear();
+            int end = std::min((ib + 1) * batch_size, numManifolds);
+            for (int i = ib * batch_size; i < end; i++) {
+                cbtPersistentManifold* contactManifold =
+                    bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+                ProcessManifold(contactManifold, m_contact_batches[ib]);
+            }
+        }
+
+        for (const auto& batch : m_contact_batches) {
+            for (const auto& icontact : batch)
+                mcontactcontainer->AddContact(icontact);
+        }
+    } else {
+        std::vector<ChCollisionInfo> contacts;
+        for (int i = 0; i < numManifolds; i++) {
+            cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+            contacts.clear();
+            ProcessManifold(contactManifold, contacts);
+            for (const auto& icontact : contacts)
+                mcontactcontainer->AddContact(icontact);
+        }
+    }
+
+    mcontactcontainer->EndAddContact();
+}
+
+void ChCollisionSystemBullet::ProcessManifold(cbtPersistentManifold* contactManifold,
+                                              std::vector<ChCollisionInfo>& contacts) {
     // NOTE: Bullet does not provide information on radius of curvature at a contact point.
     // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
     ChCollisionInfo icontact;
 
-    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
-    for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
-        const cbtCollisionObject* obA = contactManifold->getBody0();
-        const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+    const cbtCollisionObject* obA = contactManifold->getBody0();
+    const cbtCollisionObject* obB = contactManifold->getBody1();
+    contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        icontact.modelA = (ChCollisionModel*)obA->getUserPointer();
-        icontact.modelB = (ChCollisionModel*)obB->getUserPointer();
+    icontact.modelA = (ChCollisionModel*)obA->getUserPointer();
+    icontact.modelB = (ChCollisionModel*)obB->getUserPointer();
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+    double envelopeA = icontact.modelA->GetEnvelope();
+    double envelopeB = icontact.modelB->GetEnvelope();
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+    double marginA = icontact.modelA->GetSafeMargin();
+    double marginB = icontact.modelB->GetSafeMargin();
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (this->broad_callback)
-            do_narrow_contactgeneration = this->broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+    // Execute custom broadphase callback, if any
+    bool do_narrow_contactgeneration = true;
+    if (this->broad_callback)
+        do_narrow_contactgeneration = this->broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
 
-        if (do_narrow_contactgeneration) {
-            int numContacts = contactManifold->getNumContacts();
-            // GetLog() << "numContacts=" << numContacts << "\n";
-            for (int j = 0; j < numContacts; j++) {
-                cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
+    if (!do_narrow_contactgeneration)
+        return;
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    cbtVector3 ptA = pt.getPositionWorldOnA();
-                    cbtVector3 ptB = pt.getPositionWorldOnB();
+    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+    int numContacts = contactManifold->getNumContacts();
+    for (int j = 0; j < numContacts; j++) {
+        cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
+        // Discard "too far" constraints (the Bullet engine also has its threshold)
+        if (pt.getDistance() < marginA + marginB) {
+            cbtVector3 ptA = pt.getPositionWorldOnA();
+            cbtVector3 ptB = pt.getPositionWorldOnB();
 
-                    double ptdist = pt.getDistance();
+            icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+            icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
 
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
+            icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(), -pt.m_normalWorldOnB.getZ());
+            icontact.vN.Normalize();
 
-                    icontact.reaction_cache = pt.reactions_cache;
+            double ptdist = pt.getDistance();
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+            icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+            icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+            icontact.distance = ptdist + envelopeA + envelopeB;
 
-                    int indexA = compoundA ? pt.m_index0 : 0;
-                    int indexB = compoundB ? pt.m_index1 : 0;
+            icontact.reaction_cache = pt.reactions_cache;
 
-                    icontact.shapeA = icontact.modelA->GetShape(indexA).get();
-                    icontact.shapeB = icontact.modelB->GetShape(indexB).get();
+            int indexA = compoundA ? pt.m_index0 : 0;
+            int indexB = compoundB ? pt.m_index1 : 0;
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
+            icontact.shapeA = icontact.modelA->GetShape(indexA).get();
+            icontact.shapeB = icontact.modelB->GetShape(indexB).get();
 
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" << icontact.shapeB->m_type << std::endl;
+            // Execute some user custom callback, if any
+            bool add_contact = true;
+            if (this->narrow_callback)
+                add_contact = this->narrow_callback->OnNarrowphase(icontact);
 
-                        mcontactcontainer->AddContact(icontact);
-                    }
-                }
-            }
+            // Add to contact batch
+            if (add_contact)
+                contacts.push_back(icontact);
         }
-
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
     }
-    mcontactcontainer->EndAddContact();
 }
 
 void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximitycontainer) {
@@ -336,41 +371,125 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
     cbtVector3 btfrom((cbtScalar)from.x(), (cbtScalar)from.y(), (cbtScalar)from.z());
     cbtVector3 btto((cbtScalar)to.x(), (cbtScalar)to.y(), (cbtScalar)to.z());
 
-    cbtCollisionWorld::AllHitsRayResultCallback rayCallback(btfrom, btto);
+    cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
     rayCallback.m_collisionFilterGroup = filter_group;
     rayCallback.m_collisionFilterMask = filter_mask;
 
-    this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
-
-    // Find the closest hit result on the specified model (if any)
-    int hit = -1;
-    cbtScalar fraction = 1;
-    for (int i = 0; i < rayCallback.m_collisionObjects.size(); ++i) {
-        if (rayCallback.m_collisionObjects[i]->getUserPointer() == model && rayCallback.m_hitFractions[i] < fraction) {
-            hit = i;
-            fraction = rayCallback.m_hitFractions[i];
-        }
+    // Test the ray directly against the collision object of the specified model (no broadphase traversal)
+    auto bt_object = static_cast<ChCollisionModelBullet*>(model)->GetBulletModel();
+    if (bt_object->getCollisionShape() && bt_object->getBroadphaseHandle() &&
+        rayCallback.needsCollision(bt_object->getBroadphaseHandle())) {
+        cbtTransform tfrom(cbtQuaternion::getIdentity(), btfrom);
+        cbtTransform tto(cbtQuaternion::getIdentity(), btto);
+        cbtCollisionWorld::rayTestSingle(tfrom, tto, bt_object, bt_object->getCollisionShape(),
+                                         bt_object->getWorldTransform(), rayCallback);
     }
 
     // Ray does not hit specified model
-    if (hit == -1) {
+    if (!rayCallback.hasHit()) {
         result.hit = false;
         return false;
     }
 
     // Return the closest hit on the specified model
     result.hit = true;
-    result.hitModel = static_cast<ChCollisionModel*>(rayCallback.m_collisionObjects[hit]->getUserPointer());
-    result.abs_hitPoint.Set(rayCallback.m_hitPointWorld[hit].x(), rayCallback.m_hitPointWorld[hit].y(),
-                            rayCallback.m_hitPointWorld[hit].z());
-    result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld[hit].x(), rayCallback.m_hitNormalWorld[hit].y(),
-                             rayCallback.m_hitNormalWorld[hit].z());
+    result.hitModel = model;
+    result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
+                            rayCallback.m_hitPointWorld.z());
+    result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
+                             rayCallback.m_hitNormalWorld.z());
     result.abs_hitNormal.Normalize();
-    result.dist_factor = fraction;
+    result.dist_factor = rayCallback.m_closestHitFraction;
     result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
     return true;
 }
 
+void ChCollisionSystemBullet::RayHitBatch(const std::vector<ChVector<>>& from,
+                                          const std::vector<ChVector<>>& to,
+                                          std::vector<ChRayhitResult>& results,
+                                          ChCollisionModel* model) const {
+    assert(from.size() == to.size());
+    int num_rays = (int)from.size();
+
+    results.resize(num_rays);
+
+    // Ray tests only read the collision world (the broadphase uses a local traversal stack, see BT_THREADSAFE)
+#pragma omp parallel for schedule(dynamic, 64) num_threads(m_num_threads)
+    for (int i = 0; i < num_rays; i++) {
+        if (model)
+            RayHit(from[i], to[i], model, results[i]);
+        else
+            RayHit(from[i], to[i], results[i]);
+    }
+}
+
+// Closest hit of a convex sweep, ignoring the specified collision object.
+class SweepResultCallback : public cbtCollisionWorld::ClosestConvexResultCallback {
+  public:
+    SweepResultCallback(const cbtVector3& from, const cbtVector3& to, const cbtCollisionObject* object)
+        : cbtCollisionWorld::ClosestConvexResultCallback(from, to), m_object(object), m_child(0) {}
+
+    virtual bool needsCollision(cbtBroadphaseProxy* proxy0) const override {
+        if (proxy0->m_clientObject == m_object)
+            return false;
+        return cbtCollisionWorld::ClosestConvexResultCallback::needsCollision(proxy0);
+    }
+
+    virtual cbtScalar addSingleResult(cbtCollisionWorld::LocalConvexResult& convexResult,
+                                      bool normalInWorldSpace) override {
+        // For a compound shape, the index of the child shape is reported as a triangle index, with no shape part
+        const cbtCollisionWorld::LocalShapeInfo* info = convexResult.m_localShapeInfo;
+        auto shape_type = convexResult.m_hitCollisionObject->getCollisionShape()->getShapeType();
+        bool compound = (shape_type == COMPOUND_SHAPE_PROXYTYPE);
+        m_child = (compound && info && info->m_shapePart == -1) ? info->m_triangleIndex : 0;
+        return cbtCollisionWorld::ClosestConvexResultCallback::addSingleResult(convexResult, normalInWorldSpace);
+    }
+
+    const cbtCollisionObject* m_object;  // collision object to ignore
+    int m_child;                         // index of hit child shape
+};
+
+bool ChCollisionSystemBullet::SweepSphere(const ChVector<>& from,
+                                          const ChVector<>& to,
+                                          double radius,
+                                          ChCollisionModel* model,
+                                          ChSweephitResult& result) const {
+    auto model_bt = static_cast<ChCollisionModelBullet*>(model);
+
+    cbtVector3 btfrom((cbtScalar)from.x(), (cbtScalar)from.y(), (cbtScalar)from.z());
+    cbtVector3 btto((cbtScalar)to.x(), (cbtScalar)to.y(), (cbtScalar)to.z());
+    cbtTransform tfrom(cbtQuaternion::getIdentity(), btfrom);
+    cbtTransform tto(cbtQuaternion::getIdentity(), btto);
+
+    cbtSphereShape sphere((cbtScalar)radius);
+
+    SweepResultCallback sweepCallback(btfrom, btto, model_bt->GetBulletModel());
+    sweepCallback.m_collisionFilterGroup = model_bt->GetFamilyGroup();
+    sweepCallback.m_collisionFilterMask = model_bt->GetFamilyMask();
+
+    bt_collision_world->convexSweepTest(&sphere, tfrom, tto, sweepCallback);
+
+    result.hit = sweepCallback.hasHit();
+    if (!result.hit)
+        return false;
+
+    result.hitModel = (ChCollisionModel*)(sweepCallback.m_hitCollisionObject->getUserPointer());
+    int num_shapes = result.hitModel->GetNumShapes();
+    result.hitShape = sweepCallback.m_child < num_shapes ? result.hitModel->GetShape(sweepCallback.m_child).get()
+                                                         : nullptr;
+    result.abs_hitPoint.Set(sweepCallback.m_hitPointWorld.x(), sweepCallback.m_hitPointWorld.y(),
+                            sweepCallback.m_hitPointWorld.z());
+    result.abs_hitNormal.Set(sweepCallback.m_hitNormalWorld.x(), sweepCallback.m_hitNormalWorld.y(),
+                             sweepCallback.m_hitNormalWorld.z());
+    result.abs_hitNormal.Normalize();
+    result.dist_factor = sweepCallback.m_closestHitFraction;
+
+    // Bullet shapes are inflated by the collision envelope; move the hit point onto the actual surface
+    result.abs_hitPoint -= result.abs_hitNormal * result.hitModel->GetEnvelope();
+
+    return true;
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (cbtScalar)threshold;
 }
@@ -54,6 +54,17 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// Set the number of OpenMP threads for collision detection.
     virtual void SetNumThreads(int nthreads) override;
 
+    /// Enable parallel computation of the collision model AABBs at the beginning of the broadphase (default: false).
+    /// The AABBs are computed using the number of threads set through SetNumThreads; the broadphase tree update and the
+    /// search for overlapping pairs remain serial.
+    void SetParallelBroadphase(bool val);
+
+    /// Enable parallel processing of the contact manifolds in ReportContacts (default: false).
+    /// If enabled, manifolds are refreshed and converted to contacts in parallel, in thread-local batches which are then
+    /// added to the contact container in the same order as in the serial case. Note that any user-provided broadphase
+    /// or narrowphase callbacks are then invoked concurrently and must be thread-safe.
+    void SetParallelContactReporting(bool val) { m_parallel_report = val; }
+
     /// Run the algorithm and finds all the contacts.
     /// (Contacts will be managed by the Bullet persistent contact cache).
     virtual void Run() override;
@@ -97,6 +108,20 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform a batch of ray-hit tests, with all collision models or only with the specified collision model (if not
+    /// null). Rays are processed in parallel, using the number of threads set through SetNumThreads.
+    virtual void RayHitBatch(const std::vector<ChVector<>>& from,
+                             const std::vector<ChVector<>>& to,
+                             std::vector<ChRayhitResult>& results,
+                             ChCollisionModel* model = nullptr) const override;
+
+    /// Perform a sphere sweep test with the collision models (using the Bullet convex sweep test).
+    virtual bool SweepSphere(const ChVector<>& from,
+                             const ChVector<>& to,
+                             double radius,
+                             ChCollisionModel* model,
+                             ChSweephitResult& result) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -132,6 +157,9 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Refresh the specified contact manifold and append its contacts (as reported to a contact container).
+    void ProcessManifold(cbtPersistentManifold* manifold, std::vector<ChCollisionInfo>& contacts);
+
     cbtCollisionConfiguration* bt_collision_configuration;
     cbtCollisionDispatcher* bt_dispatcher;
     cbtBroadphaseInterface* bt_broadphase;
@@ -149,6 +177,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     cbtCollisionAlgorithmCreateFunc* m_emptyCreateFunc;
 
     cbtIDebugDraw* m_debug_drawer;
+
+    int m_num_threads;       ///< number of threads for batched ray-hit tests and parallel contact reporting
+    bool m_parallel_report;  ///< process contact manifolds in parallel
+    std::vector<std::vector<ChCollisionInfo>> m_contact_batches;  ///< thread-local contact batches
 };
 
 /// @} collision_bullet
@@ -17,14 +17,16 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <utility>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystemChrono.h"
-#include "chrono/collision/chrono/ChRayTest.h"
 
 namespace chrono {
 namespace collision {
 
-ChCollisionSystemChrono::ChCollisionSystemChrono() : use_aabb_active(false) {
+ChCollisionSystemChrono::ChCollisionSystemChrono() : use_aabb_active(false), use_reaction_cache(false) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -39,6 +41,8 @@ ChCollisionSystemChrono::~ChCollisionSystemChrono() {}
 
 void ChCollisionSystemChrono::SetEnvelope(double envelope) {
     cd_data->collision_envelope = real(envelope);
+    ResetBroadphaseCache();
+    narrowphase.ClearPairCache();
 }
 
 void ChCollisionSystemChrono::SetBroadphaseGridResolution(const ChVector<int>& num_bins) {
@@ -56,8 +60,14 @@ void ChCollisionSystemChrono::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemChrono::SetBroadphaseBVH(double rebuild_ratio) {
+    broadphase.SetBVHRebuildRatio(rebuild_ratio);
+    broadphase.grid_type = ChBroadphase::GridType::BVH;
+}
+
 void ChCollisionSystemChrono::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
+    narrowphase.ClearPairCache();
 }
 
 void ChCollisionSystemChrono::EnableActiveBoundingBox(const ChVector<>& aabb_min, const ChVector<>& aabb_max) {
@@ -67,6 +77,40 @@ void ChCollisionSystemChrono::EnableActiveBoundingBox(const ChVector<>& aabb_min
     use_aabb_active = true;
 }
 
+void ChCollisionSystemChrono::EnableReactionCache(bool val) {
+    use_reaction_cache = val;
+    if (!val)
+        Clear();
+}
+
+void ChCollisionSystemChrono::EnableBroadphaseCache(bool val) {
+    cd_data->use_broadphase_cache = val;
+    ResetBroadphaseCache();
+}
+
+void ChCollisionSystemChrono::EnableNarrowphaseCache(bool val, double tolerance) {
+    narrowphase.EnablePairCache(val, real(tolerance));
+}
+
+void ChCollisionSystemChrono::EnableContactReduction(bool val, int max_contacts, double max_angle) {
+    narrowphase.EnableContactReduction(val, max_contacts, real(max_angle));
+}
+
+void ChCollisionSystemChrono::ResetBroadphaseCache() {
+    aabb_cache_min.clear();
+    aabb_cache_max.clear();
+    aabb_cache_id.clear();
+    body_cache_pos.clear();
+    body_cache_rot.clear();
+}
+
+void ChCollisionSystemChrono::Clear() {
+    reaction_cache.clear();
+    reaction_cache_old.clear();
+    reaction_cache_map.clear();
+    narrowphase.ClearPairCache();
+}
+
 void ChCollisionSystemChrono::SetNumThreads(int nthreads) {
 #ifdef _OPENMP
     omp_set_num_threads(nthreads);
@@ -100,6 +144,24 @@ double ChCollisionSystemChrono::GetTimerCollisionNarrow() const {
     return m_timer_narrow();
 }
 
+double ChCollisionSystemChrono::GetAABBCacheHitRate() const {
+    if (cd_data->num_rigid_shapes == 0)
+        return 0;
+    return cd_data->num_cached_aabb / (double)cd_data->num_rigid_shapes;
+}
+
+double ChCollisionSystemChrono::GetNarrowphaseCacheHitRate() const {
+    if (narrowphase.num_potential_rigid_contacts == 0)
+        return 0;
+    return narrowphase.GetNumCachedPairs() / (double)narrowphase.num_potential_rigid_contacts;
+}
+
+double ChCollisionSystemChrono::GetBinCacheHitRate() const {
+    if (cd_data->num_rigid_shapes == 0)
+        return 0;
+    return cd_data->num_cached_bins / (double)cd_data->num_rigid_shapes;
+}
+
 // -----------------------------------------------------------------------------
 
 void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
@@ -108,7 +170,17 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
 
     ChCollisionModelChrono* pmodel = static_cast<ChCollisionModelChrono*>(model);
 
+    // Complete any pending removal first. Body IDs shift when bodies (with or without collision models) are removed
+    // from the system, so also update the shape body IDs if the ID of this body is still used by another body.
     int body_id = pmodel->GetBody()->GetId();
+    if (!removed_bodies.empty() ||
+        (body_id < (int)id_bodies.size() && id_bodies[body_id] && id_bodies[body_id] != pmodel->GetBody()))
+        ProcessRemovals();
+
+    if (body_id >= (int)id_bodies.size())
+        id_bodies.resize(body_id + 1, nullptr);
+    id_bodies[body_id] = pmodel->GetBody();
+
     short2 fam = S2(pmodel->GetFamilyGroup(), pmodel->GetFamilyMask());
     // The offset for this shape will the current total number of points in the convex data list
     auto& shape_data = cd_data->shape_data;
@@ -181,6 +253,10 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
                 shape_data.triangle_rigid.push_back(obB);
                 shape_data.triangle_rigid.push_back(obC);
                 break;
+            case ChCollisionShape::Type::TRIANGLEMESH:
+                start = (int)shape_data.mesh_rigid.size();
+                shape_data.mesh_rigid.push_back(shape->mesh);
+                break;
             default:
                 start = -1;
                 break;
@@ -200,98 +276,225 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
     }
 }
 
-#define ERASE_MACRO(x, y) x.erase(x.begin() + y);
-#define ERASE_MACRO_LEN(x, y, z) x.erase(x.begin() + y, x.begin() + y + z);
-
 void ChCollisionSystemChrono::Remove(ChCollisionModel* model) {
-    /*
     ChCollisionModelChrono* pmodel = static_cast<ChCollisionModelChrono*>(model);
-    int body_id = pmodel->GetBody()->GetId();
-    //loop over the models we nned to remove
-    //std::cout << "removing: " << pmodel->GetNumShapes() << " objects" << std::endl;
-    for (int j = 0; j < pmodel->GetNumShapes(); j++) {
-        //find a model to remove
-        bool removed = false;
-        for (int i = 0; i < shape_data.id_rigid.size(); i++) {
-            if (shape_data.id_rigid[i] == body_id) {
-                int index = i;
-                cd_data->num_rigid_shapes--;
-
-                int start = shape_data.start_rigid[index];
-                int length = shape_data.length_rigid[index];
-                int type = shape_data.typ_rigid[index];
-
-                //std::cout << "removing: type " << type << " " << start<< " " <<j << std::endl;
-
-
-                switch (type) {
-                case ChCollisionShape::Type::SPHERE:
-                    ERASE_MACRO_LEN(shape_data.sphere_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::ELLIPSOID:
-                    ERASE_MACRO_LEN(shape_data.box_like_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::BOX:
-                    ERASE_MACRO_LEN(shape_data.box_like_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::CYLINDER:
-                    ERASE_MACRO_LEN(shape_data.box_like_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::CYLSHELL:
-                    ERASE_MACRO_LEN(shape_data.box_like_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::CONE:
-                    ERASE_MACRO_LEN(shape_data.box_like_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::CAPSULE:
-                    ERASE_MACRO_LEN(shape_data.capsule_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::ROUNDEDBOX:
-                    ERASE_MACRO_LEN(shape_data.rbox_like_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::ROUNDEDCYL:
-                    ERASE_MACRO_LEN(shape_data.rbox_like_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::ROUNDEDCONE:
-                    ERASE_MACRO_LEN(shape_data.rbox_like_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::CONVEX:
-                    ERASE_MACRO_LEN(shape_data.convex_rigid, start, length);
-                    break;
-                case ChCollisionShape::Type::TRIANGLE:
-                    ERASE_MACRO_LEN(shape_data.convex_rigid, start, 3);
-                    break;
-                }
 
-                ERASE_MACRO(shape_data.ObA_rigid, index);
-                ERASE_MACRO(shape_data.ObR_rigid, index);
-                ERASE_MACRO(shape_data.start_rigid, index);
-                ERASE_MACRO(shape_data.length_rigid, index);
+    // Only record the body here; shapes are deleted (for all removed models at once) in ProcessRemovals
+    removed_bodies.push_back(pmodel->GetBody());
+}
 
-                ERASE_MACRO(shape_data.fam_rigid, index);
-                ERASE_MACRO(shape_data.typ_rigid, index);
-                ERASE_MACRO(shape_data.id_rigid, index);
-                removed = true;
-                break;
-            }
+// Arrays with shape dimension data
+enum ShapeDataArray {
+    SPHERE_DATA,
+    BOX_DATA,
+    CAPSULE_DATA,
+    RBOX_DATA,
+    CONVEX_DATA,
+    TRIANGLE_DATA,
+    MESH_DATA,
+    NUM_SHAPE_DATA
+};
+
+// Return the array with dimension data for a shape of given type (-1 if none) and the number of entries it uses.
+static int GetShapeDataArray(int type, int length, int& num_entries) {
+    num_entries = 1;
+    switch (type) {
+        case ChCollisionShape::Type::SPHERE:
+            return SPHERE_DATA;
+        case ChCollisionShape::Type::ELLIPSOID:
+        case ChCollisionShape::Type::BOX:
+        case ChCollisionShape::Type::CYLINDER:
+        case ChCollisionShape::Type::CYLSHELL:
+        case ChCollisionShape::Type::CONE:
+            return BOX_DATA;
+        case ChCollisionShape::Type::CAPSULE:
+            return CAPSULE_DATA;
+        case ChCollisionShape::Type::ROUNDEDBOX:
+        case ChCollisionShape::Type::ROUNDEDCYL:
+        case ChCollisionShape::Type::ROUNDEDCONE:
+            return RBOX_DATA;
+        case ChCollisionShape::Type::CONVEX:
+            num_entries = length;
+            return CONVEX_DATA;
+        case ChCollisionShape::Type::TRIANGLE:
+            num_entries = 3;
+            return TRIANGLE_DATA;
+        case ChCollisionShape::Type::TRIANGLEMESH:
+            return MESH_DATA;
+        default:
+            return -1;
+    }
+}
+
+// Set of disjoint ranges (start, number of entries) to be deleted from a data array.
+struct DataRanges {
+    std::vector<std::pair<int, int>> ranges;
+    std::vector<int> num_before;  // total number of entries in all preceding ranges
+
+    void Finalize() {
+        std::sort(ranges.begin(), ranges.end());
+        ranges.erase(std::unique(ranges.begin(), ranges.end()), ranges.end());
+        num_before.resize(ranges.size() + 1);
+        num_before[0] = 0;
+        for (size_t r = 0; r < ranges.size(); r++)
+            num_before[r + 1] = num_before[r] + ranges[r].second;
+    }
+
+    // New index of a retained entry, after deletion of all ranges
+    int NewIndex(int index) const {
+        auto r = std::lower_bound(ranges.begin(), ranges.end(), std::make_pair(index, 0));
+        return index - num_before[r - ranges.begin()];
+    }
+
+    // Delete all ranges from the given array, shifting the retained entries
+    template <typename T>
+    void Erase(std::vector<T>& data) const {
+        if (ranges.empty())
+            return;
+        size_t dst = ranges[0].first;
+        for (size_t r = 0; r < ranges.size(); r++) {
+            size_t src = ranges[r].first + ranges[r].second;
+            size_t end = (r + 1 < ranges.size()) ? ranges[r + 1].first : data.size();
+            while (src < end)
+                data[dst++] = data[src++];
         }
-        //std::cout << "decrement start "<< std::endl;
-        if (removed) {
-            //we removed a model, all of the starts are off by one, decrement all starts before removing a second model
-            for (int i = 0; i < shape_data.start_rigid.size(); i++) {
-                if (shape_data.start_rigid[i] != 0) {
-                    shape_data.start_rigid[i] -= 1;
-                }
+        data.resize(dst);
+    }
+};
+
+void ChCollisionSystemChrono::ProcessRemovals() {
+    auto& shape_data = cd_data->shape_data;
+    int num_shapes = (int)cd_data->num_rigid_shapes;
+    int num_ids = (int)id_bodies.size();
+
+    // Map from current to new body IDs, with -1 for bodies whose shapes are deleted. Bodies still in the system keep
+    // their current ID (their index in the body list), which changes whenever a preceding body was removed.
+    std::sort(removed_bodies.begin(), removed_bodies.end());
+    std::vector<int> new_id(num_ids, -1);
+    bool changed = !removed_bodies.empty();
+    for (int id = 0; id < num_ids; id++) {
+        ChBody* body = id_bodies[id];
+        if (!body || std::binary_search(removed_bodies.begin(), removed_bodies.end(), body))
+            continue;
+        new_id[id] = (int)body->GetId();
+        changed |= (new_id[id] != id);
+    }
+    removed_bodies.clear();
+
+    if (!changed)
+        return;
+
+    int num_new_ids = 0;
+    for (int id = 0; id < num_ids; id++)
+        num_new_ids = std::max(num_new_ids, new_id[id] + 1);
+    std::vector<ChBody*> new_id_bodies(num_new_ids, nullptr);
+    for (int id = 0; id < num_ids; id++) {
+        if (new_id[id] >= 0)
+            new_id_bodies[new_id[id]] = id_bodies[id];
+    }
+    id_bodies.swap(new_id_bodies);
+
+    // Collect the dimension data of all deleted shapes
+    DataRanges data_ranges[NUM_SHAPE_DATA];
+    for (int i = 0; i < num_shapes; i++) {
+        if (new_id[shape_data.id_rigid[i]] >= 0)
+            continue;
+        int num_entries;
+        int array = GetShapeDataArray(shape_data.typ_rigid[i], shape_data.length_rigid[i], num_entries);
+        if (array >= 0)
+            data_ranges[array].ranges.push_back(std::make_pair(shape_data.start_rigid[i], num_entries));
+    }
+    for (auto& ranges : data_ranges)
+        ranges.Finalize();
+
+    data_ranges[SPHERE_DATA].Erase(shape_data.sphere_rigid);
+    data_ranges[BOX_DATA].Erase(shape_data.box_like_rigid);
+    data_ranges[CAPSULE_DATA].Erase(shape_data.capsule_rigid);
+    data_ranges[RBOX_DATA].Erase(shape_data.rbox_like_rigid);
+    data_ranges[CONVEX_DATA].Erase(shape_data.convex_rigid);
+    data_ranges[TRIANGLE_DATA].Erase(shape_data.triangle_rigid);
+    data_ranges[MESH_DATA].Erase(shape_data.mesh_rigid);
+
+    // Compact the per-shape arrays (preserving the order of the retained shapes)
+    std::vector<int> new_shape(num_shapes, -1);
+    int count = 0;
+    for (int i = 0; i < num_shapes; i++) {
+        int id = new_id[shape_data.id_rigid[i]];
+        if (id < 0)
+            continue;
+
+        int start = shape_data.start_rigid[i];
+        int num_entries;
+        int array = GetShapeDataArray(shape_data.typ_rigid[i], shape_data.length_rigid[i], num_entries);
+        if (array >= 0)
+            start = data_ranges[array].NewIndex(start);
+
+        shape_data.fam_rigid[count] = shape_data.fam_rigid[i];
+        shape_data.id_rigid[count] = id;
+        shape_data.typ_rigid[count] = shape_data.typ_rigid[i];
+        shape_data.local_rigid[count] = shape_data.local_rigid[i];
+        shape_data.start_rigid[count] = start;
+        shape_data.length_rigid[count] = shape_data.length_rigid[i];
+        shape_data.ObR_rigid[count] = shape_data.ObR_rigid[i];
+        shape_data.ObA_rigid[count] = shape_data.ObA_rigid[i];
+        new_shape[i] = count++;
+    }
+
+    shape_data.fam_rigid.resize(count);
+    shape_data.id_rigid.resize(count);
+    shape_data.typ_rigid.resize(count);
+    shape_data.local_rigid.resize(count);
+    shape_data.start_rigid.resize(count);
+    shape_data.length_rigid.resize(count);
+    shape_data.ObR_rigid.resize(count);
+    shape_data.ObA_rigid.resize(count);
+    cd_data->num_rigid_shapes = count;
+
+    // Remap the cached AABBs (indexed by shape ID) and body states (indexed by body ID). Body states are not cached
+    // for bodies without shapes, so set their cached rotation to an invalid value.
+    if (!aabb_cache_id.empty()) {
+        int num_cached_shapes = std::min((int)aabb_cache_id.size(), num_shapes);
+        int num_cached_bodies = std::min((int)body_cache_pos.size(), num_ids);
+        int k = 0;
+        for (int i = 0; i < num_cached_shapes; i++) {
+            if (new_shape[i] < 0)
+                continue;
+            aabb_cache_min[k] = aabb_cache_min[i];
+            aabb_cache_max[k] = aabb_cache_max[i];
+            aabb_cache_id[k] = (aabb_cache_id[i] < (uint)num_ids) ? new_id[aabb_cache_id[i]] : -1;
+            k++;
+        }
+        aabb_cache_min.resize(k);
+        aabb_cache_max.resize(k);
+        aabb_cache_id.resize(k);
+
+        std::vector<real3> cache_pos(num_new_ids);
+        std::vector<quaternion> cache_rot(num_new_ids, quaternion(0, 0, 0, 0));
+        for (int id = 0; id < num_cached_bodies; id++) {
+            if (new_id[id] >= 0) {
+                cache_pos[new_id[id]] = body_cache_pos[id];
+                cache_rot[new_id[id]] = body_cache_rot[id];
             }
         }
+        body_cache_pos.swap(cache_pos);
+        body_cache_rot.swap(cache_rot);
+    }
 
+    // Remap the narrowphase pair cache, discarding the pairs involving deleted shapes
+    narrowphase.RemapPairCache(new_shape);
+
+    // Update the shape IDs in the reaction cache; entries for deleted shapes will not match any new contact.
+    // Note that the cache entries must not be reallocated, as they may still be referenced by existing contacts.
+    for (auto& entry : reaction_cache) {
+        int s1 = int(entry.shape_pair >> 32);
+        int s2 = int(entry.shape_pair & 0xffffffff);
+        if (s1 >= num_shapes || s2 >= num_shapes || new_shape[s1] < 0 || new_shape[s2] < 0)
+            entry.shape_pair = -1;
+        else
+            entry.shape_pair = ((long long)new_shape[s1] << 32 | (long long)new_shape[s2]);
     }
-*/
 }
 
-#undef ERASE_MACRO
-#undef ERASE_MACRO_LEN
-
 // -----------------------------------------------------------------------------
 
 void ChCollisionSystemChrono::ResetTimers() {
@@ -349,6 +552,14 @@ void ChCollisionSystemChrono::PostProcess() {
 void ChCollisionSystemChrono::Run() {
     ResetTimers();
 
+    ProcessRemovals();
+
+    // Generate the shape AABBs, also used to find the bodies in the active box. This is done only once per pass, since
+    // it also flags the shapes of bodies that moved since the previous pass (see EnableBroadphaseCache).
+    m_timer_broad.start();
+    GenerateAABB();
+    m_timer_broad.stop();
+
     if (use_aabb_active) {
         std::vector<char>& active = *cd_data->state_data.active_rigid;
         const std::vector<char>& collide = *cd_data->state_data.collide_rigid;
@@ -368,7 +579,6 @@ void ChCollisionSystemChrono::Run() {
 
     // Broadphase
     m_timer_broad.start();
-    GenerateAABB();
     broadphase.Process();
     m_timer_broad.stop();
 
@@ -392,6 +602,10 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
     const auto& sids = cd_data->contact_shapeIDs;          // global IDs of shapes in contact
     const auto& sindex = cd_data->shape_data.local_rigid;  // collision model indexes of shapes in contact
 
+    // Match current contacts with those at the previous step and carry over their reactions
+    if (use_reaction_cache)
+        UpdateReactionCache();
+
     // Loop over all current contacts, create the cinfo structure and add contact to the container.
     // Note that inclusions in the contact container cannot be done in parallel.
     for (uint i = 0; i < cd_data->num_rigid_contacts; i++) {
@@ -412,6 +626,8 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
         cinfo.vpB = ToChVector(cd_data->cptb_rigid_rigid[i]);
         cinfo.distance = cd_data->dpth_rigid_rigid[i];
         cinfo.eff_radius = cd_data->erad_rigid_rigid[i];
+        if (use_reaction_cache)
+            cinfo.reaction_cache = reaction_cache[i].reactions;
 
         // Execute user custom callback, if any
         bool add_contact = true;
@@ -425,6 +641,56 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
     container->EndAddContact();
 }
 
+void ChCollisionSystemChrono::UpdateReactionCache() {
+    const auto& bids = cd_data->bids_rigid_rigid;
+    const auto& sids = cd_data->contact_shapeIDs;
+    const auto& position = *cd_data->state_data.pos_rigid;
+    const auto& rotation = *cd_data->state_data.rot_rigid;
+    uint num_contacts = cd_data->num_rigid_contacts;
+
+    // The current cache becomes the old one. Index old entries by shape pair (chaining entries for the same pair).
+    // Note that the contacts created at the previous step (if any) still point into the old cache, but they are
+    // reused or discarded by the contact container before any access to their reactions.
+    std::swap(reaction_cache, reaction_cache_old);
+    reaction_cache_map.clear();
+    for (int j = (int)reaction_cache_old.size() - 1; j >= 0; j--) {
+        auto entry = reaction_cache_map.insert(std::make_pair(reaction_cache_old[j].shape_pair, j));
+        reaction_cache_old[j].next = entry.second ? -1 : entry.first->second;
+        entry.first->second = j;
+    }
+
+    // Create the new cache entries. The cache is never resized after this, so that pointers to its entries remain
+    // valid (and are updated by the contacts with the newly computed reactions) until the next call.
+    real tolerance2 = cd_data->collision_envelope * cd_data->collision_envelope;
+    reaction_cache.resize(num_contacts);
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        auto& entry = reaction_cache[i];
+        entry.shape_pair = sids[i];
+        entry.pt_loc = RotateT(cd_data->cpta_rigid_rigid[i] - position[bids[i].x], rotation[bids[i].x]);
+        entry.next = -1;
+        std::fill(entry.reactions, entry.reactions + 6, 0.0f);
+
+        // Find the closest contact point between the same two shapes at the previous step (if any)
+        auto first = reaction_cache_map.find(entry.shape_pair);
+        if (first == reaction_cache_map.end())
+            continue;
+        int closest = -1;
+        real min_dist2 = tolerance2;
+        for (int j = first->second; j != -1; j = reaction_cache_old[j].next) {
+            real dist2 = Length2(reaction_cache_old[j].pt_loc - entry.pt_loc);
+            if (dist2 <= min_dist2) {
+                min_dist2 = dist2;
+                closest = j;
+            }
+        }
+        if (closest != -1)
+            std::copy(reaction_cache_old[closest].reactions, reaction_cache_old[closest].reactions + 6,
+                      entry.reactions);
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 static void ComputeAABBSphere(const real& radius,
@@ -530,7 +796,26 @@ void ChCollisionSystemChrono::GenerateAABB() {
         aabb_min.resize(num_rigid_shapes);
         aabb_max.resize(num_rigid_shapes);
 
+        // Flag bodies that moved since the previous call (all bodies, if caching is disabled)
+        const bool use_cache = cd_data->use_broadphase_cache;
+        const int num_rigid_bodies = (int)cd_data->state_data.num_rigid_bodies;
+        const int num_cached_bodies = use_cache ? (int)body_cache_pos.size() : 0;
+        const int num_cached_shapes = use_cache ? (int)aabb_cache_id.size() : 0;
+        std::vector<char>& shape_moved = cd_data->shape_moved;
+
+        body_moved.resize(num_rigid_bodies);
+        shape_moved.resize(num_rigid_shapes);
+
 #pragma omp parallel for
+        for (int i = 0; i < num_rigid_bodies; i++) {
+            body_moved[i] = (i >= num_cached_bodies || !(pos_rigid[i] == body_cache_pos[i]) ||
+                             body_rot[i].w != body_cache_rot[i].w || body_rot[i].x != body_cache_rot[i].x ||
+                             body_rot[i].y != body_cache_rot[i].y || body_rot[i].z != body_cache_rot[i].z);
+        }
+
+        uint num_cached_aabb = 0;
+
+#pragma omp parallel for reduction(+ : num_cached_aabb)
         for (int index = 0; index < (signed)num_rigid_shapes; index++) {
             // Shape data
             shape_type type = typ_rigid[index];
@@ -539,10 +824,21 @@ void ChCollisionSystemChrono::GenerateAABB() {
             uint id = id_rigid[index];  // The rigid body corresponding to this shape
             int start = start_rigid[index];
 
+            shape_moved[index] = 1;
+
             // Body data
             if (id == UINT_MAX)
                 continue;
 
+            // Reuse the AABB from the previous call if the body did not move
+            if (index < num_cached_shapes && aabb_cache_id[index] == id && !body_moved[id]) {
+                aabb_min[index] = aabb_cache_min[index];
+                aabb_max[index] = aabb_cache_max[index];
+                shape_moved[index] = 0;
+                num_cached_aabb++;
+                continue;
+            }
+
             real3 position = pos_rigid[id];
             quaternion rotation = Mult(body_rot[id], local_rot);
             real3 temp_min;
@@ -589,6 +885,13 @@ void ChCollisionSystemChrono::GenerateAABB() {
 
                 ComputeAABBTriangle(A, B, C, temp_min, temp_max);
 
+            } else if (type == ChCollisionShape::Type::TRIANGLEMESH) {
+                // AABB of the box bounding the mesh in its own frame
+                const auto& mesh = cd_data->shape_data.mesh_rigid[start];
+                real3 center = local_pos + Rotate(0.5 * (mesh->GetMin() + mesh->GetMax()), local_rot);
+                real3 B = 0.5 * (mesh->GetMax() - mesh->GetMin()) + envelope;
+                ComputeAABBBox(B, center, position, rotation, body_rot[id], temp_min, temp_max);
+
             } else {
                 continue;
             }
@@ -596,12 +899,21 @@ void ChCollisionSystemChrono::GenerateAABB() {
             aabb_min[index] = temp_min;
             aabb_max[index] = temp_max;
         }
+
+        cd_data->num_cached_aabb = num_cached_aabb;
+
+        // Cache the AABBs (in the global frame) and the body states for the next call
+        if (use_cache) {
+            aabb_cache_min = aabb_min;
+            aabb_cache_max = aabb_max;
+            aabb_cache_id = id_rigid;
+            body_cache_pos.assign(pos_rigid.begin(), pos_rigid.begin() + num_rigid_bodies);
+            body_cache_rot.assign(body_rot.begin(), body_rot.begin() + num_rigid_bodies);
+        }
     }
 }
 
 void ChCollisionSystemChrono::GetOverlappingAABB(std::vector<char>& active_id, real3 Amin, real3 Amax) {
-    GenerateAABB();
-
 #pragma omp parallel for
     for (int i = 0; i < cd_data->shape_data.typ_rigid.size(); i++) {
         real3 Bmin = cd_data->aabb_min[i];
@@ -628,38 +940,118 @@ std::vector<vec2> ChCollisionSystemChrono::GetOverlappingPairs() {
 // -----------------------------------------------------------------------------
 
 bool ChCollisionSystemChrono::RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& result) const {
-    if (cd_data->num_active_bins == 0) {
-        result.hit = false;
-        return false;
-    }
-
     ChRayTest tester(cd_data);
-    ChRayTest::RayHitInfo info;
-    if (tester.Check(FromChVector(from), FromChVector(to), info)) {
-        // Hit point
-        result.hit = true;
-        result.abs_hitNormal = ToChVector(info.normal);
-        result.abs_hitPoint = ToChVector(info.point);
-        result.dist_factor = info.t;
-
-        // ID of the body carring the closest hit shape
-        uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+    return RayHit(tester, from, to, 0, -1, result);
+}
 
-        // Collision model of hit body
-        result.hitModel = m_system->Get_bodylist()[bid]->GetCollisionModel().get();
+bool ChCollisionSystemChrono::RayHit(const ChVector<>& from,
+                                     const ChVector<>& to,
+                                     ChCollisionModel* model,
+                                     ChRayhitResult& result) const {
+    ChRayTest tester(cd_data);
+    int first_shape, num_shapes;
+    FindShapes(model, first_shape, num_shapes);
+    return RayHit(tester, from, to, first_shape, num_shapes, result);
+}
 
-        return true;
+void ChCollisionSystemChrono::RayHitBatch(const std::vector<ChVector<>>& from,
+                                          const std::vector<ChVector<>>& to,
+                                          std::vector<ChRayhitResult>& results,
+                                          ChCollisionModel* model) const {
+    assert(from.size() == to.size());
+    int num_rays = (int)from.size();
+    int first_shape = 0;
+    int num_shapes = -1;
+    if (model)
+        FindShapes(model, first_shape, num_shapes);
+
+    results.resize(num_rays);
+
+#pragma omp parallel
+    {
+        // The collision data is only read during ray tests; use a separate tester on each thread
+        ChRayTest tester(cd_data);
+
+#pragma omp for schedule(dynamic, 64)
+        for (int i = 0; i < num_rays; i++) {
+            RayHit(tester, from[i], to[i], first_shape, num_shapes, results[i]);
+        }
     }
+}
 
-    result.hit = false;
-    return false;
+void ChCollisionSystemChrono::FindShapes(ChCollisionModel* model, int& first_shape, int& num_shapes) const {
+    const auto& id_rigid = cd_data->shape_data.id_rigid;
+    int num_rigid_shapes = (int)cd_data->num_rigid_shapes;
+    uint body_id = static_cast<ChCollisionModelChrono*>(model)->GetBody()->GetId();
+
+    first_shape = 0;
+    num_shapes = 0;
+    while (first_shape < num_rigid_shapes && id_rigid[first_shape] != body_id)
+        first_shape++;
+    while (first_shape + num_shapes < num_rigid_shapes && id_rigid[first_shape + num_shapes] == body_id)
+        num_shapes++;
 }
 
-bool ChCollisionSystemChrono::RayHit(const ChVector<>& from,
+bool ChCollisionSystemChrono::RayHit(ChRayTest& tester,
+                                     const ChVector<>& from,
                                      const ChVector<>& to,
-                                     ChCollisionModel* model,
+                                     int first_shape,
+                                     int num_shapes,
                                      ChRayhitResult& result) const {
-    return false;
+    result.hit = false;
+    if (cd_data->num_active_bins == 0 && cd_data->bvh_num_leaves == 0)
+        return false;
+
+    ChRayTest::RayHitInfo info;
+    bool hit = (num_shapes < 0)
+                   ? tester.Check(FromChVector(from), FromChVector(to), info)
+                   : tester.CheckShapes(FromChVector(from), FromChVector(to), first_shape, num_shapes, info);
+    if (!hit)
+        return false;
+
+    // Hit point
+    result.hit = true;
+    result.abs_hitNormal = ToChVector(info.normal);
+    result.abs_hitPoint = ToChVector(info.point);
+    result.dist_factor = info.t;
+
+    // ID of the body carring the closest hit shape
+    uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+
+    // Collision model of hit body
+    result.hitModel = m_system->Get_bodylist()[bid]->GetCollisionModel().get();
+
+    return true;
+}
+
+bool ChCollisionSystemChrono::SweepSphere(const ChVector<>& from,
+                                          const ChVector<>& to,
+                                          double radius,
+                                          ChCollisionModel* model,
+                                          ChSweephitResult& result) const {
+    result.hit = false;
+    if (cd_data->num_active_bins == 0 && cd_data->bvh_num_leaves == 0)
+        return false;
+
+    ChRayTest tester(cd_data);
+    ChRayTest::RayHitInfo info;
+    short2 family = S2(model->GetFamilyGroup(), model->GetFamilyMask());
+    int body_id = (int)static_cast<ChCollisionModelChrono*>(model)->GetBody()->GetId();
+    if (!tester.CheckSphere(FromChVector(from), FromChVector(to), (real)radius, family, body_id, info))
+        return false;
+
+    // Contact point and normal
+    result.hit = true;
+    result.abs_hitNormal = ToChVector(info.normal);
+    result.abs_hitPoint = ToChVector(info.point);
+    result.dist_factor = info.t;
+
+    // Collision model and shape hit
+    uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+    result.hitModel = m_system->Get_bodylist()[bid]->GetCollisionModel().get();
+    result.hitShape = result.hitModel->GetShape(cd_data->shape_data.local_rigid[info.shapeID]).get();
+
+    return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -883,6 +1275,19 @@ void ChCollisionSystemChrono::VisualizeShapes() {
                 vis_callback->DrawLine(ToChVector(C), ToChVector(A), ChColor(1, 0, 0));
                 break;
             }
+            case ChCollisionShape::Type::TRIANGLEMESH: {
+                const auto& mesh = cd_data->shape_data.mesh_rigid[start];
+                for (int i = 0; i < mesh->GetNumTriangles(); i++) {
+                    const real3* tri = mesh->GetTriangle(i);
+                    real3 A = TransformLocalToParent(position, rotation, tri[0]);
+                    real3 B = TransformLocalToParent(position, rotation, tri[1]);
+                    real3 C = TransformLocalToParent(position, rotation, tri[2]);
+                    vis_callback->DrawLine(ToChVector(A), ToChVector(B), ChColor(1, 0, 0));
+                    vis_callback->DrawLine(ToChVector(B), ToChVector(C), ChColor(1, 0, 0));
+                    vis_callback->DrawLine(ToChVector(C), ToChVector(A), ChColor(1, 0, 0));
+                }
+                break;
+            }
         }
     }
 }
@@ -20,6 +20,8 @@
 #ifndef CH_COLLISION_SYSTEM_CHRONO_H
 #define CH_COLLISION_SYSTEM_CHRONO_H
 
+#include <unordered_map>
+
 #include "chrono/core/ChTimer.h"
 
 #include "chrono/collision/ChCollisionSystem.h"
@@ -27,6 +29,7 @@
 #include "chrono/collision/chrono/ChCollisionData.h"
 #include "chrono/collision/chrono/ChBroadphase.h"
 #include "chrono/collision/chrono/ChNarrowphase.h"
+#include "chrono/collision/chrono/ChRayTest.h"
 
 #include "chrono/multicore_math/ChMulticoreMath.h"
 
@@ -67,6 +70,13 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Use a bounding volume hierarchy (BVH) instead of a grid for the broadphase.
+    /// The BVH adapts to highly non-uniform shape sizes and distributions, for which no single grid resolution is
+    /// appropriate. It is refitted at each step and rebuilt only when the total area of its internal nodes exceeds
+    /// `rebuild_ratio` times the area after the last rebuild, or when the number of collision shapes changes.
+    /// Note that a grid is still used if the system contains 3-dof particles.
+    void SetBroadphaseBVH(double rebuild_ratio = 2);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -78,18 +88,53 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// The size of the bounding box is specified by its min and max extents.
     void EnableActiveBoundingBox(const ChVector<>& aabb_min, const ChVector<>& aabb_max);
 
+    /// Enable caching of contact reactions across time steps (default: false).
+    /// If enabled, each contact reported at the current step is matched with a contact from the previous step (same
+    /// pair of collision shapes and contact point within a distance equal to the collision envelope, measured in the
+    /// frame of the first body), and the contact receives, through ChCollisionInfo::reaction_cache, the reactions
+    /// computed at the previous step. These are used as initial guess by the NSC iterative solvers when warm starting
+    /// is enabled (see ChIterativeSolver::EnableWarmStart), similar to the persistent manifolds of the Bullet system.
+    void EnableReactionCache(bool val);
+
+    /// Enable caching of broadphase data across time steps (default: false).
+    /// If enabled, the AABBs of collision shapes attached to bodies that did not move since the previous step (in
+    /// particular, fixed and sleeping bodies) are not recomputed. Moreover, with a broadphase grid, the grid is kept
+    /// unchanged as long as it still encloses all shapes (and is not much larger than needed) and the bin intersections
+    /// of these shapes are reused, so that only moving shapes are re-binned. The cache assumes that the collision
+    /// shapes of a body do not change after the body is added to the system. See GetAABBCacheHitRate and
+    /// GetBinCacheHitRate.
+    void EnableBroadphaseCache(bool val);
+
+    /// Enable caching of narrowphase results for candidate shape pairs across time steps (default: false).
+    /// If enabled, a pair found not in contact at the previous step is skipped while the shapes remain separated along
+    /// the separating axis found at that step. The contacts of a pair in contact at the previous step are reused if no
+    /// point of the second shape moved by more than `tolerance` relative to the first shape. The default zero
+    /// tolerance only reuses contacts of pairs with unchanged relative pose; a small positive value (a fraction of the
+    /// collision envelope) also reuses contacts in slowly moving resting stacks, at the cost of approximate contact
+    /// points. See ChNarrowphase::EnablePairCache and GetNarrowphaseCacheHitRate.
+    void EnableNarrowphaseCache(bool val, double tolerance = 0);
+
+    /// Enable reduction of the contacts reported for each pair of bodies (default: false).
+    /// If enabled, the contacts between two bodies are clustered by their normals (within the specified angle) and at
+    /// most `max_contacts` representative contacts are kept in each cluster, spread over the contact area and with
+    /// depths averaged over the contacts they replace. This shrinks the contact problem for bodies resting on flat
+    /// faces of triangle meshes or convex hulls. See ChNarrowphase::EnableContactReduction and GetNumReducedContacts.
+    void EnableContactReduction(bool val, int max_contacts = 4, double max_angle = CH_C_PI / 12);
+
     /// Get the dimensions of the "active" box.
     /// The return value indicates whether or not the active box feature is enabled.
     bool GetActiveBoundingBox(ChVector<>& aabb_min, ChVector<>& aabb_max) const;
 
     /// Clear all data instanced by this algorithm if any (like persistent contact manifolds).
-    virtual void Clear(void) override {}
+    virtual void Clear(void) override;
 
     /// Add a collision model to the collision engine.
     virtual void Add(ChCollisionModel* model) override;
 
     /// Remove a collision model from the collision engine.
-    /// Currently not implemented.
+    /// Removal is deferred: the shapes of all models removed since the last collision detection pass are deleted, in a
+    /// single compaction of the shape data arrays, at the next call to Run() or Add(). If bodies were removed from the
+    /// system, the IDs of the remaining bodies are then reset to their index in the system's body list.
     virtual void Remove(ChCollisionModel* model) override;
 
     /// Set the number of OpenMP threads for collision detection.
@@ -118,6 +163,21 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// Return the time (in seconds) for narrowphase collision detection.
     virtual double GetTimerCollisionNarrow() const override;
 
+    /// Return the fraction of collision shapes with AABB reused from the previous step during the last broadphase.
+    /// Always 0 if the broadphase cache is disabled (see EnableBroadphaseCache).
+    double GetAABBCacheHitRate() const;
+
+    /// Return the fraction of collision shapes with bin intersections reused from the previous step during the last
+    /// broadphase. Always 0 if the broadphase cache is disabled (see EnableBroadphaseCache) or if using a BVH.
+    double GetBinCacheHitRate() const;
+
+    /// Return the fraction of candidate pairs resolved from the narrowphase pair cache during the last narrowphase.
+    /// Always 0 if the narrowphase cache is disabled (see EnableNarrowphaseCache).
+    double GetNarrowphaseCacheHitRate() const;
+
+    /// Return the number of contacts removed by contact reduction at the last collision detection step.
+    unsigned int GetNumReducedContacts() const { return narrowphase.GetNumReducedContacts(); }
+
     /// Fill in the provided contact container with collision information after Run().
     virtual void ReportContacts(ChContactContainer* container) override;
 
@@ -126,16 +186,30 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     virtual void ReportProximities(ChProximityContainer* mproximitycontainer) override {}
 
     /// Perform a ray-hit test with all collision models.
-    /// Currently not implemented.
     virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& result) const override;
 
     /// Perform a ray-hit test with the specified collision model.
-    /// Currently not implemented.
     virtual bool RayHit(const ChVector<>& from,
                         const ChVector<>& to,
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform a batch of ray-hit tests, with all collision models or only with the specified collision model (if not
+    /// null). Rays are processed in parallel, each thread with its own ChRayTest. Rays tested against all models
+    /// traverse the broadphase grid (or BVH); rays tested against a single model are only checked against its shapes.
+    virtual void RayHitBatch(const std::vector<ChVector<>>& from,
+                             const std::vector<ChVector<>>& to,
+                             std::vector<ChRayhitResult>& results,
+                             ChCollisionModel* model = nullptr) const override;
+
+    /// Perform a sphere sweep test with the collision models (see ChRayTest::CheckSphere).
+    /// Only shape types supported by the PRIMS narrowphase for collision with a sphere are considered.
+    virtual bool SweepSphere(const ChVector<>& from,
+                             const ChVector<>& to,
+                             double radius,
+                             ChCollisionModel* model,
+                             ChSweephitResult& result) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -147,9 +221,11 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
 
   protected:
     /// Mark bodies whose AABB is contained within the specified box.
+    /// Uses the shape AABBs already generated for the current step (see GenerateAABB).
     virtual void GetOverlappingAABB(std::vector<char>& active_id, real3 Amin, real3 Amax);
 
     /// Generate the current axis-aligned bounding boxes of collision shapes.
+    /// Must be called only once per collision detection pass, since it also updates the broadphase cache.
     void GenerateAABB();
 
     /// Visualize collision shapes (wireframe).
@@ -161,6 +237,27 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// Visualize contact points and normals.
     void VisualizeContacts();
 
+    /// Perform a ray-hit test with the given tester, with all shapes (if num_shapes < 0) or only with the specified
+    /// range of shapes.
+    bool RayHit(ChRayTest& tester,
+                const ChVector<>& from,
+                const ChVector<>& to,
+                int first_shape,
+                int num_shapes,
+                ChRayhitResult& result) const;
+
+    /// Find the range of shapes of the specified collision model (stored contiguously in the shape data arrays).
+    void FindShapes(ChCollisionModel* model, int& first_shape, int& num_shapes) const;
+
+    /// Invalidate all cached AABBs and body states (see EnableBroadphaseCache).
+    void ResetBroadphaseCache();
+
+    /// Delete the shapes of all collision models removed since the last call and compact the shape data arrays.
+    /// Shape body IDs are updated to the current body IDs (which change whenever a body, colliding or not, is removed
+    /// from the system). Entries in the reaction, broadphase, and narrowphase caches are remapped to the new shape and
+    /// body IDs; only the entries of deleted shapes are discarded.
+    void ProcessRemovals();
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     collision::ChBroadphase broadphase;    ///< methods for broad-phase collision detection
@@ -168,6 +265,32 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
 
     std::vector<char> body_active;
 
+    std::vector<ChBody*> id_bodies;       ///< body for each body ID used by the shapes (nullptr if no shapes)
+    std::vector<ChBody*> removed_bodies;  ///< bodies with collision models removed since last update
+
+    /// Cached reactions for one contact, persistent across time steps.
+    struct ReactionCacheEntry {
+        long long shape_pair;  ///< shape IDs for the contact (encoded in a single long long)
+        real3 pt_loc;          ///< contact point on first shape, expressed in the frame of the first body
+        float reactions[6];    ///< contact reactions (forces and, for rolling contacts, torques)
+        int next;              ///< index of next entry for the same shape pair (-1 if none)
+    };
+
+    /// Find the contacts from the previous step matching the current contacts and set up the current reaction cache.
+    void UpdateReactionCache();
+
+    bool use_reaction_cache;                                ///< enable caching of contact reactions across steps
+    std::vector<ReactionCacheEntry> reaction_cache;         ///< reaction cache for current contacts
+    std::vector<ReactionCacheEntry> reaction_cache_old;     ///< reaction cache for contacts at previous step
+    std::unordered_map<long long, int> reaction_cache_map;  ///< first old cache entry for each shape pair
+
+    std::vector<char> body_moved;            ///< flags indicating bodies that moved since the last AABB update
+    std::vector<real3> aabb_cache_min;       ///< shape AABB minimum points (global frame) at the last AABB update
+    std::vector<real3> aabb_cache_max;       ///< shape AABB maximum points (global frame) at the last AABB update
+    std::vector<uint> aabb_cache_id;         ///< shape body IDs at the last AABB update
+    std::vector<real3> body_cache_pos;       ///< body positions at the last AABB update
+    std::vector<quaternion> body_cache_rot;  ///< body rotations at the last AABB update
+
     bool use_aabb_active;   ///< enable freezing of objects outside the active bounding box
     real3 active_aabb_min;  ///< lower corner of active bounding box
     real3 active_aabb_max;  ///< upper corner of active bounding box
@@ -34,6 +34,7 @@ subject to the following restrictions:
 #include "LinearMath/cbtAabbUtil2.h"
 #include "LinearMath/cbtQuickprof.h"
 #include "LinearMath/cbtSerializer.h"
+#include "LinearMath/cbtThreads.h" //***CHRONO***
 #include "BulletCollision/CollisionShapes/cbtConvexPolyhedron.h"
 #include "BulletCollision/CollisionDispatch/cbtCollisionObjectWrapper.h"
 
@@ -69,7 +70,8 @@ cbtCollisionWorld::cbtCollisionWorld(cbtDispatcher* dispatcher, cbtBroadphaseInt
 	: m_dispatcher1(dispatcher),
 	  m_broadphasePairCache(pairCache),
 	  m_debugDrawer(0),
-	  m_forceUpdateAllAabbs(true)
+	  m_forceUpdateAllAabbs(true),
+	  m_parallelAabbs(false)
 {
 }
 
@@ -154,6 +156,12 @@ void cbtCollisionWorld::addCollisionObject(cbtCollisionObject* collisionObject,
 void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 {
 	cbtVector3 minAabb, maxAabb;
+	computeSingleAabb(colObj, minAabb, maxAabb);
+	setSingleAabb(colObj, minAabb, maxAabb);
+}
+
+void cbtCollisionWorld::computeSingleAabb(const cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb) const
+{
 	colObj->getCollisionShape()->getAabb(colObj->getWorldTransform(), minAabb, maxAabb);
 	//need to increase the aabb for contact thresholds
 	cbtVector3 contactThreshold(gContactBreakingThreshold, gContactBreakingThreshold, gContactBreakingThreshold);
@@ -170,7 +178,10 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 		minAabb.setMin(minAabb2);
 		maxAabb.setMax(maxAabb2);
 	}
+}
 
+void cbtCollisionWorld::setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb)
+{
 	cbtBroadphaseInterface* bp = (cbtBroadphaseInterface*)m_broadphasePairCache;
 
 	//moving objects should be moderately sized, probably something wrong if not
@@ -196,10 +207,56 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 	}
 }
 
+// ***CHRONO*** compute the AABBs of a range of collision objects
+struct CollisionWorldAabbUpdater : public cbtIParallelForBody
+{
+	const cbtCollisionWorld* mWorld;
+	cbtCollisionObject* const* mObjects;
+	cbtVector3* mAabbsMin;
+	cbtVector3* mAabbsMax;
+	bool mForceUpdateAll;
+
+	void forLoop(int iBegin, int iEnd) const
+	{
+		for (int i = iBegin; i < iEnd; ++i)
+		{
+			if (mForceUpdateAll || mObjects[i]->isActive())
+			{
+				mWorld->computeSingleAabb(mObjects[i], mAabbsMin[i], mAabbsMax[i]);
+			}
+		}
+	}
+};
+
 void cbtCollisionWorld::updateAabbs()
 {
 	BT_PROFILE("updateAabbs");
 
+	// ***CHRONO*** compute all AABBs in parallel, then update the broadphase serially (in the same order)
+	if (m_parallelAabbs && m_collisionObjects.size() > 0)
+	{
+		m_aabbsMin.resizeNoInitialize(m_collisionObjects.size());
+		m_aabbsMax.resizeNoInitialize(m_collisionObjects.size());
+
+		CollisionWorldAabbUpdater updater;
+		updater.mWorld = this;
+		updater.mObjects = &m_collisionObjects[0];
+		updater.mAabbsMin = &m_aabbsMin[0];
+		updater.mAabbsMax = &m_aabbsMax[0];
+		updater.mForceUpdateAll = m_forceUpdateAllAabbs;
+		cbtParallelFor(0, m_collisionObjects.size(), 64, updater);
+
+		for (int i = 0; i < m_collisionObjects.size(); i++)
+		{
+			cbtCollisionObject* colObj = m_collisionObjects[i];
+			if (m_forceUpdateAllAabbs || colObj->isActive())
+			{
+				setSingleAabb(colObj, m_aabbsMin[i], m_aabbsMax[i]);
+			}
+		}
+		return;
+	}
+
 	cbtTransform predictedTrans;
 	for (int i = 0; i < m_collisionObjects.size(); i++)
 	{
@@ -102,6 +102,11 @@ protected:
 	///it is true by default, because it is error-prone (setting the position of static objects wouldn't update their AABB)
 	bool m_forceUpdateAllAabbs;
 
+	// ***CHRONO*** compute the AABBs of all objects in parallel in updateAabbs
+	bool m_parallelAabbs;
+	cbtAlignedObjectArray<cbtVector3> m_aabbsMin;
+	cbtAlignedObjectArray<cbtVector3> m_aabbsMax;
+
 	void serializeCollisionObjects(cbtSerializer* serializer);
 
 	void serializeContactManifolds(cbtSerializer* serializer);
@@ -144,6 +149,10 @@ public:
 
 	void updateSingleAabb(cbtCollisionObject* colObj);
 
+	// ***CHRONO*** split updateSingleAabb, so that the AABB computation can be done in parallel
+	void computeSingleAabb(const cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb) const;
+	void setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb);
+
 	virtual void updateAabbs();
 
 	///the computeOverlappingPairs is usually already called by performDiscreteCollisionDetection (or stepSimulation)
@@ -509,6 +518,17 @@ public:
 		m_forceUpdateAllAabbs = forceUpdateAllAabbs;
 	}
 
+	// ***CHRONO***
+	///if true, updateAabbs computes the object AABBs in parallel (using cbtParallelFor) before updating the broadphase
+	bool getParallelAabbs() const
+	{
+		return m_parallelAabbs;
+	}
+	void setParallelAabbs(bool parallelAabbs)
+	{
+		m_parallelAabbs = parallelAabbs;
+	}
+
 	///Preliminary serialization test for Bullet 2.76. Loading those files requires a separate parser (Bullet/Demos/SerializeDemo)
 	virtual void serialize(cbtSerializer* serializer);
 
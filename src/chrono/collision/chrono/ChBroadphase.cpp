@@ -39,6 +39,10 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      bvh_rebuild_ratio(2),
+      bvh_build_cost(0),
+      grid_reused(false),
+      bin_cache_resolution(vec3(0, 0, 0)),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -152,6 +156,23 @@ void ChBroadphase::DetermineBoundingBox() {
         max_point = Max(max_point, cd_data->ff_max_bounding_point);
     }
 
+    // With the broadphase cache, keep the current grid as long as it encloses all shapes and is at most twice as large
+    // as needed in each direction, so that the bin intersections of shapes that did not move remain valid.
+    grid_reused = false;
+    if (cd_data->use_broadphase_cache && cd_data->state_data.num_fluid_bodies == 0 && !bin_cache_start.empty()) {
+        const real3& grid_min = cd_data->min_bounding_point;
+        const real3& grid_max = cd_data->max_bounding_point;
+        real3 grid_size = grid_max - grid_min;
+        real3 size = max_point - min_point;
+        grid_reused = true;
+        for (int i = 0; i < 3; i++) {
+            if (min_point[i] < grid_min[i] || max_point[i] > grid_max[i] || 2 * size[i] < grid_size[i])
+                grid_reused = false;
+        }
+        if (grid_reused)
+            return;
+    }
+
     // Inflate the overall bounding box by a small percentage.
     // This takes care of corner cases where a degenerate object bounding box is on the
     // boundary of the overall bounding box.
@@ -197,6 +218,7 @@ void ChBroadphase::ComputeTopLevelResolution() {
             bins_per_axis.z = (int)std::ceil(diag.z / bin_size.z);
             break;
         case GridType::FIXED_DENSITY:
+        case GridType::BVH:  // grid only used with 3-dof particles
             bins_per_axis = Compute_Grid_Resolution(num_shapes, diag, grid_density);
     }
 
@@ -215,6 +237,26 @@ void ChBroadphase::Process() {
     DetermineBoundingBox();
     OffsetAABB();
 
+    cd_data->num_cached_bins = 0;
+
+    // The rigid-fluid narrowphase relies on the broadphase grid, so always use a grid if there are 3-dof particles
+    if (grid_type == GridType::BVH && cd_data->state_data.num_fluid_bodies == 0) {
+        bin_cache_start.clear();
+        cd_data->num_bins = 0;
+        cd_data->num_active_bins = 0;
+        cd_data->num_bin_aabb_intersections = 0;
+        if (cd_data->num_rigid_shapes != 0) {
+            BVHBroadphase();
+        } else {
+            cd_data->bvh_num_leaves = 0;
+            cd_data->num_possible_collisions = 0;
+        }
+        cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
+        return;
+    }
+
+    cd_data->bvh_num_leaves = 0;
+
     // Determine resolution of the top level grid
     ComputeTopLevelResolution();
 
@@ -257,16 +299,32 @@ void ChBroadphase::OneLevelBroadphase() {
     bin_intersections.resize(num_shapes + 1);
     bin_intersections[num_shapes] = 0;
 
+    // With the broadphase cache, reuse the bin intersections of shapes that did not move if the grid did not change
+    const bool use_cache = cd_data->use_broadphase_cache;
+    const std::vector<char>& shape_moved = cd_data->shape_moved;
+    const bool reuse_bins = use_cache && grid_reused && (int)shape_moved.size() == num_shapes &&
+                            (int)bin_cache_start.size() == num_shapes + 1 &&
+                            bins_per_axis.x == bin_cache_resolution.x && bins_per_axis.y == bin_cache_resolution.y &&
+                            bins_per_axis.z == bin_cache_resolution.z;
+    uint num_cached_bins = 0;
+
     // Count the number of bins intersected by each shape AABB -> bin_intersections
-#pragma omp parallel for
+#pragma omp parallel for reduction(+ : num_cached_bins)
     for (int i = 0; i < num_shapes; i++) {
         if (obj_data_id[i] == UINT_MAX) {
             bin_intersections[i] = 0;
             continue;
         }
+        if (reuse_bins && !shape_moved[i]) {
+            bin_intersections[i] = bin_cache_start[i + 1] - bin_cache_start[i];
+            num_cached_bins++;
+            continue;
+        }
         f_Count_AABB_BIN_Intersection(i, inv_bin_size, aabb_min, aabb_max, bin_intersections);
     }
 
+    cd_data->num_cached_bins = num_cached_bins;
+
     // Calculate total number of bin - shape AABB intersections
     Thrust_Exclusive_Scan(bin_intersections);
     num_bin_aabb_intersections = bin_intersections.back();
@@ -281,10 +339,28 @@ void ChBroadphase::OneLevelBroadphase() {
     for (int i = 0; i < num_shapes; i++) {
         if (obj_data_id[i] == UINT_MAX)
             continue;
+        if (reuse_bins && !shape_moved[i]) {
+            uint count = bin_intersections[i + 1] - bin_intersections[i];
+            for (uint k = 0; k < count; k++) {
+                bin_number[bin_intersections[i] + k] = bin_cache_number[bin_cache_start[i] + k];
+                bin_aabb_number[bin_intersections[i] + k] = i;
+            }
+            continue;
+        }
         f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
                                       bin_aabb_number);
     }
 
+    // Save the bin intersections of all shapes (before sorting) for use at the next step
+    if (use_cache) {
+        bin_cache_start = bin_intersections;
+        bin_cache_number = bin_number;
+        bin_cache_resolution = bins_per_axis;
+    } else {
+        bin_cache_start.clear();
+        bin_cache_number.clear();
+    }
+
     // Find the number of active bins (i.e. with at least one shape AABB intersection)
     Thrust_Sort_By_Key(bin_number, bin_aabb_number);
     num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
@@ -344,5 +420,318 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// BVH broadphase.
+// The BVH is a binary radix tree over the shape AABBs sorted by the Morton codes of their centers, built in parallel
+// (T. Karras, "Maximizing Parallelism in the Construction of BVHs, Octrees, and k-d Trees", HPG 2012). Node AABBs are
+// refitted level by level, from the deepest level up; the nodes in a given level are processed in parallel.
+
+// Maximum depth of the BVH: keys are unique 64-bit values and the length of the common key prefix strictly increases
+// from a node to its children, so any traversal stack of this size cannot overflow.
+static const int bvh_stack_size = 66;
+
+// Count leading zero bits.
+static inline int CountLeadingZeros(unsigned long long x) {
+    if (x == 0)
+        return 64;
+    int n = 0;
+    for (int shift = 32; shift > 0; shift /= 2) {
+        if ((x >> (64 - shift)) == 0) {
+            n += shift;
+            x <<= shift;
+        }
+    }
+    return n;
+}
+
+// Spread the lower 10 bits of the argument, inserting two zero bits between consecutive bits.
+static inline uint ExpandBits(uint v) {
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+// 30-bit Morton code of a point, given the reciprocal of the extents of the domain (relative to the origin).
+static inline uint MortonCode(const real3& p, const real3& inv_size) {
+    uint code = 0;
+    for (int i = 0; i < 3; i++) {
+        real x = Clamp(p[i] * inv_size[i] * 1024, real(0), real(1023));
+        code |= ExpandBits((uint)x) << (2 - i);
+    }
+    return code;
+}
+
+// Length of the longest common prefix of the keys of leaves i and j (-1 if j is out of range).
+static inline int KeyPrefix(const std::vector<unsigned long long>& keys, int i, int j) {
+    if (j < 0 || j >= (int)keys.size())
+        return -1;
+    return CountLeadingZeros(keys[i] ^ keys[j]);
+}
+
+// Check whether two shapes, with overlapping AABBs, can collide.
+static inline bool CandidatePair(uint shapeA,
+                                 uint shapeB,
+                                 const std::vector<uint>& body_id,
+                                 const std::vector<short2>& fam_data,
+                                 const std::vector<char>& body_active,
+                                 const std::vector<char>& body_collide) {
+    uint bodyA = body_id[shapeA];
+    uint bodyB = body_id[shapeB];
+    if (bodyA == UINT_MAX || bodyB == UINT_MAX)
+        return false;
+    if (bodyA == bodyB)
+        return false;
+    if (body_collide[bodyA] == 0 || body_collide[bodyB] == 0)
+        return false;
+    if (!body_active[bodyA] && !body_active[bodyB])
+        return false;
+    return collide(fam_data[shapeA], fam_data[shapeB]);
+}
+
+void ChBroadphase::BuildBVH() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<unsigned long long>& keys = cd_data->bvh_keys;
+    std::vector<uint>& shape = cd_data->bvh_shape;
+    std::vector<vec2>& children = cd_data->bvh_children;
+    std::vector<vec2>& range = cd_data->bvh_range;
+
+    const int n = cd_data->num_rigid_shapes;
+
+    // Sort the shapes by the Morton code of their AABB center (the shape ID in the lower bits makes the keys unique)
+    real3 size = cd_data->max_bounding_point - cd_data->global_origin;
+    real3 inv_size(size.x > 0 ? 1 / size.x : 0, size.y > 0 ? 1 / size.y : 0, size.z > 0 ? 1 / size.z : 0);
+
+    keys.resize(n);
+#pragma omp parallel for
+    for (int i = 0; i < n; i++) {
+        uint code = MortonCode(0.5 * (aabb_min[i] + aabb_max[i]), inv_size);
+        keys[i] = ((unsigned long long)code << 32) | (unsigned long long)i;
+    }
+    thrust::sort(THRUST_PAR keys.begin(), keys.end());
+
+    shape.resize(n);
+#pragma omp parallel for
+    for (int i = 0; i < n; i++) {
+        shape[i] = (uint)(keys[i] & 0xFFFFFFFF);
+    }
+
+    // Find the range of leaves and the split position of each internal node, independently of all other nodes.
+    // Children which cover a single leaf are leaf nodes.
+    children.resize(n - 1);
+    range.resize(n - 1);
+    std::vector<uint> parent(2 * n - 1, 0);
+
+#pragma omp parallel for
+    for (int i = 0; i < n - 1; i++) {
+        // Direction of the range
+        int d = (KeyPrefix(keys, i, i + 1) - KeyPrefix(keys, i, i - 1)) > 0 ? +1 : -1;
+
+        // Upper bound for the length of the range, then the other end of the range (binary search)
+        int prefix_min = KeyPrefix(keys, i, i - d);
+        int l_max = 2;
+        while (KeyPrefix(keys, i, i + l_max * d) > prefix_min)
+            l_max *= 2;
+        int l = 0;
+        for (int t = l_max / 2; t >= 1; t /= 2) {
+            if (KeyPrefix(keys, i, i + (l + t) * d) > prefix_min)
+                l += t;
+        }
+        int j = i + l * d;
+
+        // Split position (binary search for the highest differing key bit)
+        int prefix_node = KeyPrefix(keys, i, j);
+        int s = 0;
+        int t = l;
+        do {
+            t = (t + 1) / 2;
+            if (KeyPrefix(keys, i, i + (s + t) * d) > prefix_node)
+                s += t;
+        } while (t > 1);
+        int split = i + s * d + std::min(d, 0);
+
+        int first = std::min(i, j);
+        int last = std::max(i, j);
+        int left = (first == split) ? n - 1 + split : split;
+        int right = (last == split + 1) ? n - 1 + split + 1 : split + 1;
+
+        children[i] = vec2(left, right);
+        range[i] = vec2(first, last);
+        parent[left] = i;
+        parent[right] = i;
+    }
+
+    // Sort the internal nodes by depth (counting sort)
+    std::vector<uint> depth(std::max(n - 1, 0), 0);
+#pragma omp parallel for
+    for (int i = 1; i < n - 1; i++) {
+        uint d = 0;
+        for (uint k = i; k != 0; k = parent[k])
+            d++;
+        depth[i] = d;
+    }
+
+    uint num_levels = 0;
+    for (int i = 0; i < n - 1; i++)
+        num_levels = std::max(num_levels, depth[i] + 1);
+    bvh_level_start.assign(num_levels + 1, 0);
+    for (int i = 0; i < n - 1; i++)
+        bvh_level_start[depth[i] + 1]++;
+    for (uint k = 0; k < num_levels; k++)
+        bvh_level_start[k + 1] += bvh_level_start[k];
+    bvh_level_nodes.resize(std::max(n - 1, 0));
+    std::vector<uint> pos(bvh_level_start.begin(), bvh_level_start.end() - 1);
+    for (int i = 0; i < n - 1; i++)
+        bvh_level_nodes[pos[depth[i]]++] = i;
+
+    cd_data->bvh_num_leaves = n;
+}
+
+void ChBroadphase::RefitBVH() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+    const std::vector<char>& collide_rigid = *cd_data->state_data.collide_rigid;
+    const std::vector<uint>& shape = cd_data->bvh_shape;
+    const std::vector<vec2>& children = cd_data->bvh_children;
+    std::vector<real3>& bvh_min = cd_data->bvh_min;
+    std::vector<real3>& bvh_max = cd_data->bvh_max;
+
+    const int n = cd_data->bvh_num_leaves;
+
+    bvh_min.resize(2 * n - 1);
+    bvh_max.resize(2 * n - 1);
+
+    // Leaves: AABB of the associated shape, inverted for inactive shapes or shapes on non-colliding bodies
+#pragma omp parallel for
+    for (int k = 0; k < n; k++) {
+        uint s = shape[k];
+        uint b = id_rigid[s];
+        if (b == UINT_MAX || collide_rigid[b] == 0) {
+            bvh_min[n - 1 + k] = real3(+C_REAL_MAX);
+            bvh_max[n - 1 + k] = real3(-C_REAL_MAX);
+        } else {
+            bvh_min[n - 1 + k] = aabb_min[s];
+            bvh_max[n - 1 + k] = aabb_max[s];
+        }
+    }
+
+    // Internal nodes: union of the children AABBs, from the deepest level up
+    int num_levels = (int)bvh_level_start.size() - 1;
+    for (int level = num_levels - 1; level >= 0; level--) {
+#pragma omp parallel for
+        for (int k = (int)bvh_level_start[level]; k < (int)bvh_level_start[level + 1]; k++) {
+            uint i = bvh_level_nodes[k];
+            const vec2& c = children[i];
+            bvh_min[i] = Min(bvh_min[c.x], bvh_min[c.y]);
+            bvh_max[i] = Max(bvh_max[c.x], bvh_max[c.y]);
+        }
+    }
+}
+
+real ChBroadphase::BVHCost() const {
+    const std::vector<real3>& bvh_min = cd_data->bvh_min;
+    const std::vector<real3>& bvh_max = cd_data->bvh_max;
+
+    const int n = cd_data->bvh_num_leaves;
+
+    real cost = 0;
+#pragma omp parallel for reduction(+ : cost)
+    for (int i = 0; i < n - 1; i++) {
+        real3 d = Max(bvh_max[i] - bvh_min[i], real3(0));
+        cost += d.x * d.y + d.y * d.z + d.z * d.x;
+    }
+
+    return cost;
+}
+
+void ChBroadphase::BVHBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    const int n = cd_data->num_rigid_shapes;
+
+    // Refit the current BVH if the number of shapes did not change; rebuild if this degrades its quality too much
+    bool rebuild = (cd_data->bvh_num_leaves != (uint)n);
+    if (!rebuild) {
+        RefitBVH();
+        rebuild = BVHCost() > bvh_rebuild_ratio * bvh_build_cost;
+    }
+    if (rebuild) {
+        BuildBVH();
+        RefitBVH();
+        bvh_build_cost = BVHCost();
+    }
+
+    const std::vector<uint>& shape = cd_data->bvh_shape;
+    const std::vector<vec2>& children = cd_data->bvh_children;
+    const std::vector<vec2>& range = cd_data->bvh_range;
+    const std::vector<real3>& bvh_min = cd_data->bvh_min;
+    const std::vector<real3>& bvh_max = cd_data->bvh_max;
+
+    // Traverse the BVH for each leaf, only considering leaves to its right (so that each pair is found once).
+    // The first pass counts the pairs for each leaf and the second pass stores them.
+    std::vector<uint> leaf_num_contact(n + 1);
+    leaf_num_contact[n] = 0;
+
+    for (int pass = 0; pass < 2; pass++) {
+#pragma omp parallel for schedule(dynamic, 64)
+        for (int k = 0; k < n; k++) {
+            uint shapeA = shape[k];
+            const real3& Amin = bvh_min[n - 1 + k];
+            const real3& Amax = bvh_max[n - 1 + k];
+            uint offset = (pass == 0) ? 0 : leaf_num_contact[k];
+            uint count = 0;
+
+            int stack[bvh_stack_size];
+            int top = 0;
+            if (n > 1 && Amin.x <= Amax.x)
+                stack[top++] = 0;
+
+            while (top > 0) {
+                int node = stack[--top];
+                if (!overlap(Amin, Amax, bvh_min[node], bvh_max[node]))
+                    continue;
+                if (node < n - 1) {
+                    if (range[node].y <= k)
+                        continue;
+                    stack[top++] = children[node].x;
+                    stack[top++] = children[node].y;
+                    continue;
+                }
+                if (node - (n - 1) <= k)
+                    continue;
+                uint shapeB = shape[node - (n - 1)];
+                if (!CandidatePair(shapeA, shapeB, obj_data_id, fam_data, obj_active, obj_collide))
+                    continue;
+                if (pass == 1) {
+                    // the two indices of the shapes that make up the contact
+                    uint s1 = std::min(shapeA, shapeB);
+                    uint s2 = std::max(shapeA, shapeB);
+                    pair_shapeIDs[offset + count] = ((long long)s1 << 32 | (long long)s2);
+                }
+                count++;
+            }
+
+            if (pass == 0)
+                leaf_num_contact[k] = count;
+        }
+
+        if (pass == 0) {
+            Thrust_Exclusive_Scan(leaf_num_contact);
+            num_possible_collisions = leaf_num_contact.back();
+            pair_shapeIDs.resize(num_possible_collisions);
+        }
+    }
+}
+
 }  // end namespace collision
 }  // end namespace chrono
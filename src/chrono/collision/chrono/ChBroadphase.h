@@ -34,7 +34,8 @@ class ChApi ChBroadphase {
     enum class GridType {
         FIXED_RESOLUTION,  ///< user-specified number of bins in each direction
         FIXED_BIN_SIZE,    ///< user-specified grid bin dimension
-        FIXED_DENSITY      ///< user-specified density of shapes per bin
+        FIXED_DENSITY,     ///< user-specified density of shapes per bin
+        BVH                ///< bounding volume hierarchy instead of a grid (see SetBVHRebuildRatio)
     };
 
     ChBroadphase();
@@ -43,8 +44,18 @@ class ChApi ChBroadphase {
     /// Collision detection results are loaded in the shared data object (see ChCollisionData).
     void Process();
 
+    /// Set the threshold for rebuilding the BVH (default: 2).
+    /// Used only with GridType::BVH. As long as the set of collision shapes does not change, the BVH is only refitted
+    /// to the current shape AABBs. The hierarchy is rebuilt from scratch when the total surface area of its internal
+    /// nodes exceeds the given multiple of the area right after the last rebuild.
+    void SetBVHRebuildRatio(double ratio) { bvh_rebuild_ratio = real(ratio); }
+
   private:
     void OneLevelBroadphase();
+    void BVHBroadphase();
+    void BuildBVH();
+    void RefitBVH();
+    real BVHCost() const;
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -58,6 +69,16 @@ class ChApi ChBroadphase {
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
 
+    real bvh_rebuild_ratio;              ///< (input) BVH rebuild threshold (used for GridType::BVH)
+    real bvh_build_cost;                 ///< total area of BVH internal nodes after the last rebuild
+    std::vector<uint> bvh_level_nodes;   ///< BVH internal nodes, sorted by depth
+    std::vector<uint> bvh_level_start;   ///< start of each depth level in bvh_level_nodes
+
+    bool grid_reused;                    ///< grid kept unchanged from the previous step (broadphase cache)
+    vec3 bin_cache_resolution;           ///< grid resolution at the previous step
+    std::vector<uint> bin_cache_start;   ///< start of the bin intersections of each shape in bin_cache_number
+    std::vector<uint> bin_cache_number;  ///< bin intersections of all shapes at the previous step, grouped by shape
+
     friend class ChCollisionSystemChrono;
     friend class ChCollisionSystemChronoMulticore;
 };
@@ -23,6 +23,8 @@
 
 #include "chrono/multicore_math/ChMulticoreMath.h"
 
+#include "chrono/collision/chrono/ChTriangleMeshBVH.h"
+
 namespace chrono {
 namespace collision {
 
@@ -56,6 +58,8 @@ struct shape_container {
     std::vector<real4> rbox_like_rigid;  ///< dimensions and radius for rbox-like shapes
     std::vector<real3> convex_rigid;     ///< points for convex hull shapes
 
+    std::vector<std::shared_ptr<ChTriangleMeshBVH>> mesh_rigid;  ///< triangle BVH for triangle mesh shapes
+
     std::vector<real3> triangle_global;  ///< triangle vertices in global frame
 };
 
@@ -116,6 +120,12 @@ class ChApi ChCollisionData {
           ff_max_bounding_point(real3(0)),
           ff_bins_per_axis(vec3(0)),
           //
+          bvh_num_leaves(0),
+          //
+          use_broadphase_cache(false),
+          num_cached_aabb(0),
+          num_cached_bins(0),
+          //
           num_rigid_shapes(0),
           num_rigid_contacts(0),
           num_rigid_fluid_contacts(0),
@@ -213,6 +223,23 @@ class ChApi ChCollisionData {
     std::vector<uint> bin_start_index_ext;  ///< [num_bins+1]
     std::vector<uint> bin_num_contact;      ///< [num_active_bins+1]
 
+    // BVH broadphase data (ChBroadphase::GridType::BVH).
+    // Nodes 0 to num_leaves-2 are internal nodes (node 0 is the root); node num_leaves-1+k is the k-th leaf in Morton
+    // order. Node AABBs are expressed relative to global_origin.
+    uint bvh_num_leaves;                       ///< number of BVH leaves (0 if the BVH is not used)
+    std::vector<unsigned long long> bvh_keys;  ///< [bvh_num_leaves] sorted leaf keys (Morton code, shape ID)
+    std::vector<uint> bvh_shape;               ///< [bvh_num_leaves] shape ID of each leaf
+    std::vector<vec2> bvh_children;            ///< [bvh_num_leaves-1] children of each internal node
+    std::vector<vec2> bvh_range;               ///< [bvh_num_leaves-1] range of leaves under each internal node
+    std::vector<real3> bvh_min;                ///< [2*bvh_num_leaves-1] node AABB minimum point
+    std::vector<real3> bvh_max;                ///< [2*bvh_num_leaves-1] node AABB maximum point
+
+    // Broadphase cache data (see ChCollisionSystemChrono::EnableBroadphaseCache)
+    bool use_broadphase_cache;      ///< reuse AABBs and bin intersections of shapes on bodies that did not move
+    std::vector<char> shape_moved;  ///< [num_rigid_shapes] flags indicating shapes with AABB recomputed at this step
+    uint num_cached_aabb;           ///< number of shape AABBs reused from the previous step
+    uint num_cached_bins;           ///< number of shapes with bin intersections reused from the previous step
+
     // Indexing variables
     // ------------------
 
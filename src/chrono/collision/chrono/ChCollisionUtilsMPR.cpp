@@ -63,6 +63,11 @@ real3 SupportVertNoMargin(const chrono::collision::ConvexBase* Shape, const real
         case ChCollisionShape::Type::TETRAHEDRON:
             localSupport = GetSupportPoint_Tetrahedron(Shape->TetIndex(), Shape->TetNodes(), n);
             break;
+        default:
+            // No support function for this shape type (triangle meshes must be expanded into their triangles)
+            assert(false);
+            localSupport = real3(0);
+            break;
     }
     // The collision envelope is applied as a compound support.
     // A sphere with a radius equal to the collision envelope is swept around the
@@ -44,6 +44,7 @@ class ConvexBase {
     virtual real3 Cylshell() const { return real3(0); }
     virtual uvec4 TetIndex() const { return _make_uvec4(0, 0, 0, 0); }
     virtual const real3* TetNodes() const { return 0; }
+    virtual const ChTriangleMeshBVH* Mesh() const { return 0; }
 };
 
 /// Convex contact shape.
@@ -63,6 +64,7 @@ class ConvexShape : public ConvexBase {
     inline real4 Rbox() const override { return data->rbox_like_rigid[start()]; }
     inline real3 Cylshell() const override { return data->box_like_rigid[start()]; }
     inline real2 Capsule() const override { return data->capsule_rigid[start()]; }
+    inline const ChTriangleMeshBVH* Mesh() const override { return data->mesh_rigid[start()].get(); }
     int index;
     shape_container* data;  // pointer to convex data;
   private:
@@ -118,6 +120,7 @@ class ConvexShapeTetrahedron : public ConvexBase {
 /// Triangle contact shape.
 class ConvexShapeTriangle : public ConvexBase {
   public:
+    ConvexShapeTriangle() {}
     ConvexShapeTriangle(real3& t1, real3& t2, real3 t3) {
         tri[0] = t1;
         tri[1] = t2;
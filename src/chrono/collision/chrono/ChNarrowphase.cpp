@@ -41,8 +41,49 @@ ChNarrowphase::ChNarrowphase()
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
+      use_pair_cache(false),
+      pair_cache_tolerance(0),
+      num_cached_pairs(0),
+      use_contact_reduction(false),
+      reduction_max_contacts(4),
+      reduction_cos_angle(Cos(real(CH_C_PI / 12))),
+      num_reduced_contacts(0),
       cd_data(nullptr) {}
 
+void ChNarrowphase::EnablePairCache(bool val, real tolerance) {
+    use_pair_cache = val;
+    pair_cache_tolerance = tolerance;
+    ClearPairCache();
+}
+
+void ChNarrowphase::EnableContactReduction(bool val, int max_contacts, real max_angle) {
+    use_contact_reduction = val;
+    reduction_max_contacts = std::max(max_contacts, 1);
+    reduction_cos_angle = Cos(max_angle);
+}
+
+void ChNarrowphase::ClearPairCache() {
+    pair_cache.clear();
+    contact_cache.clear();
+}
+
+void ChNarrowphase::RemapPairCache(const std::vector<int>& new_shape) {
+    int num_shapes = (int)new_shape.size();
+    size_t count = 0;
+    for (size_t i = 0; i < pair_cache.size(); i++) {
+        int shapeA = int(pair_cache[i].shape_pair >> 32);
+        int shapeB = int(pair_cache[i].shape_pair & 0xffffffff);
+        if (shapeA >= num_shapes || shapeB >= num_shapes || new_shape[shapeA] < 0 || new_shape[shapeB] < 0)
+            continue;
+        pair_cache[count] = pair_cache[i];
+        pair_cache[count].shape_pair = ((long long)new_shape[shapeA] << 32 | (long long)new_shape[shapeB]);
+        count++;
+    }
+
+    // The shape order is preserved, so the remaining entries are still sorted by shape pair
+    pair_cache.resize(count);
+}
+
 void ChNarrowphase::ClearContacts() {
     // Return now if no potential collisions.
     if (num_potential_rigid_contacts == 0) {
@@ -77,8 +118,12 @@ void ChNarrowphase::ProcessRigids() {
     // Transform Rigid body shapes to global coordinate system
     PreprocessLocalToParent();
 
+    num_cached_pairs = 0;
+
     if (num_potential_rigid_contacts != 0) {
         ProcessRigidRigid();
+    } else {
+        ClearPairCache();
     }
 
     if (cd_data->state_data.num_fluid_bodies != 0) {
@@ -114,6 +159,12 @@ int ChNarrowphase::PreprocessCount() {
             shape_type type1 = obj_data_T[pair.x];
             shape_type type2 = obj_data_T[pair.y];
 
+            // Mesh shapes are processed one triangle at a time
+            if (type1 == ChCollisionShape::Type::TRIANGLEMESH)
+                type1 = ChCollisionShape::Type::TRIANGLE;
+            if (type2 == ChCollisionShape::Type::TRIANGLEMESH)
+                type2 = ChCollisionShape::Type::TRIANGLE;
+
             // Set the maximum number of possible contacts for this particular pair
             if (type1 == ChCollisionShape::Type::SPHERE || type2 == ChCollisionShape::Type::SPHERE) {
                 contact_index[index] = 1;
@@ -195,12 +246,144 @@ void ChNarrowphase::PreprocessLocalToParent() {
 
 // -----------------------------------------------------------------------------
 
+// Calculate the AABB, in the frame of a mesh shape, of a given AABB (in the global frame) inflated by 'envelope'.
+static void MeshLocalAABB(const real3& aabb_min,
+                          const real3& aabb_max,
+                          const real3& mesh_pos,
+                          const quaternion& mesh_rot,
+                          real envelope,
+                          real3& local_min,
+                          real3& local_max) {
+    real3 center = TransformParentToLocal(mesh_pos, mesh_rot, 0.5 * (aabb_min + aabb_max));
+    real3 hdim = AbsRotate(Inv(mesh_rot), 0.5 * (aabb_max - aabb_min)) + envelope;
+    local_min = center - hdim;
+    local_max = center + hdim;
+}
+
+void ChNarrowphase::ExpandMeshPairs() {
+    const std::vector<int>& obj_data_T = cd_data->shape_data.typ_rigid;
+    const std::vector<int>& obj_data_start = cd_data->shape_data.start_rigid;
+    const std::vector<real3>& obj_data_A = cd_data->shape_data.obj_data_A_global;
+    const std::vector<quaternion>& obj_data_R = cd_data->shape_data.obj_data_R_global;
+    const std::vector<std::shared_ptr<ChTriangleMeshBVH>>& mesh_data = cd_data->shape_data.mesh_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const real3& origin = cd_data->global_origin;  // shape AABBs are relative to the grid origin
+    const real envelope = cd_data->collision_envelope;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+
+    pair_triangles.clear();
+    if (mesh_data.empty())
+        return;
+
+    int num_pairs = (int)num_potential_rigid_contacts;
+    std::vector<std::vector<vec2>> triangles(num_pairs);
+    std::vector<uint> num_triangles(num_pairs + 1);
+    num_triangles[num_pairs] = 0;
+
+    // Find the overlapping mesh triangles for each pair
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int index = 0; index < num_pairs; index++) {
+        vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
+        bool meshA = (obj_data_T[pair.x] == ChCollisionShape::Type::TRIANGLEMESH);
+        bool meshB = (obj_data_T[pair.y] == ChCollisionShape::Type::TRIANGLEMESH);
+
+        if (!meshA && !meshB) {
+            num_triangles[index] = 1;
+            continue;
+        }
+
+        std::vector<vec2>& list = triangles[index];
+        std::vector<int> overlaps;
+        real3 local_min, local_max;
+
+        if (meshA && meshB) {
+            // Triangles of the first mesh overlapping the second mesh, then triangles of the second mesh overlapping
+            // each of these
+            const ChTriangleMeshBVH* mesh1 = mesh_data[obj_data_start[pair.x]].get();
+            const ChTriangleMeshBVH* mesh2 = mesh_data[obj_data_start[pair.y]].get();
+            MeshLocalAABB(aabb_min[pair.y] + origin, aabb_max[pair.y] + origin, obj_data_A[pair.x],
+                          obj_data_R[pair.x], envelope, local_min, local_max);
+            std::vector<int> overlaps1;
+            mesh1->FindOverlaps(local_min, local_max, overlaps1);
+            for (auto t1 : overlaps1) {
+                const real3* tri = mesh1->GetTriangle(t1);
+                real3 v0 = TransformLocalToParent(obj_data_A[pair.x], obj_data_R[pair.x], tri[0]);
+                real3 v1 = TransformLocalToParent(obj_data_A[pair.x], obj_data_R[pair.x], tri[1]);
+                real3 v2 = TransformLocalToParent(obj_data_A[pair.x], obj_data_R[pair.x], tri[2]);
+                MeshLocalAABB(Min(v0, Min(v1, v2)) - envelope, Max(v0, Max(v1, v2)) + envelope, obj_data_A[pair.y],
+                              obj_data_R[pair.y], envelope, local_min, local_max);
+                overlaps.clear();
+                mesh2->FindOverlaps(local_min, local_max, overlaps);
+                for (auto t2 : overlaps)
+                    list.push_back(vec2(t1, t2));
+            }
+        } else if (meshA) {
+            const ChTriangleMeshBVH* mesh = mesh_data[obj_data_start[pair.x]].get();
+            MeshLocalAABB(aabb_min[pair.y] + origin, aabb_max[pair.y] + origin, obj_data_A[pair.x],
+                          obj_data_R[pair.x], envelope, local_min, local_max);
+            mesh->FindOverlaps(local_min, local_max, overlaps);
+            for (auto t : overlaps)
+                list.push_back(vec2(t, -1));
+        } else {
+            const ChTriangleMeshBVH* mesh = mesh_data[obj_data_start[pair.y]].get();
+            MeshLocalAABB(aabb_min[pair.x] + origin, aabb_max[pair.x] + origin, obj_data_A[pair.y],
+                          obj_data_R[pair.y], envelope, local_min, local_max);
+            mesh->FindOverlaps(local_min, local_max, overlaps);
+            for (auto t : overlaps)
+                list.push_back(vec2(-1, t));
+        }
+
+        num_triangles[index] = (uint)list.size();
+    }
+
+    Thrust_Exclusive_Scan(num_triangles);
+    uint num_expanded = num_triangles.back();
+
+    // Replicate each pair once for each of its triangles (or pairs of triangles)
+    std::vector<long long> expanded_shapeIDs(num_expanded);
+    pair_triangles.resize(num_expanded);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        uint start = num_triangles[index];
+        if (triangles[index].empty()) {
+            if (num_triangles[index + 1] > start) {
+                expanded_shapeIDs[start] = pair_shapeIDs[index];
+                pair_triangles[start] = vec2(-1, -1);
+            }
+            continue;
+        }
+        for (size_t k = 0; k < triangles[index].size(); k++) {
+            expanded_shapeIDs[start + k] = pair_shapeIDs[index];
+            pair_triangles[start + k] = triangles[index][k];
+        }
+    }
+
+    pair_shapeIDs.swap(expanded_shapeIDs);
+    num_potential_rigid_contacts = num_expanded;
+}
+
+// Set the given triangle shape to the specified triangle of a mesh shape (in global frame).
+static void SetMeshTriangle(const ConvexShape* shape, int triangle, ConvexShapeTriangle* tri) {
+    const real3* vertices = shape->Mesh()->GetTriangle(triangle);
+    real3 pos = shape->A();
+    quaternion rot = shape->R();
+    tri->tri[0] = TransformLocalToParent(pos, rot, vertices[0]);
+    tri->tri[1] = TransformLocalToParent(pos, rot, vertices[1]);
+    tri->tri[2] = TransformLocalToParent(pos, rot, vertices[2]);
+}
+
 void ChNarrowphase::Dispatch_Init(uint index,
                                   uint& icoll,
                                   uint& ID_A,
                                   uint& ID_B,
                                   ConvexShape* shapeA,
-                                  ConvexShape* shapeB) {
+                                  ConvexShape* shapeB,
+                                  ConvexShapeTriangle* triA,
+                                  ConvexShapeTriangle* triB,
+                                  const ConvexBase*& A,
+                                  const ConvexBase*& B) {
     const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
     const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
 
@@ -217,6 +400,22 @@ void ChNarrowphase::Dispatch_Init(uint index,
     shapeA->data = &cd_data->shape_data;
     shapeB->data = &cd_data->shape_data;
 
+    A = shapeA;
+    B = shapeB;
+
+    // For a pair involving a mesh, collide with the mesh triangle(s) for this pair
+    if (!pair_triangles.empty()) {
+        const vec2& tri = pair_triangles[index];
+        if (tri.x >= 0) {
+            SetMeshTriangle(shapeA, tri.x, triA);
+            A = triA;
+        }
+        if (tri.y >= 0) {
+            SetMeshTriangle(shapeB, tri.y, triB);
+            B = triB;
+        }
+    }
+
     //// TODO: what is the best way to dispatch this?
     icoll = contact_index[index];
 }
@@ -231,6 +430,178 @@ void ChNarrowphase::Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC)
     }
 }
 
+// Calculate the pose of shape B relative to shape A.
+static inline void RelativePose(const ConvexBase* A, const ConvexBase* B, real3& rel_pos, quaternion& rel_rot) {
+    rel_pos = RotateT(B->A() - A->A(), A->R());
+    rel_rot = Mult(Inv(A->R()), B->R());
+}
+
+// Check whether two shapes, inflated by the collision envelope, are separated along the given axis (from A to B).
+static inline bool Separated(const ConvexBase* A, const ConvexBase* B, const real3& axis, real envelope) {
+    real maxA = Dot(TransformSupportVert(A, axis, envelope), axis);
+    real minB = Dot(TransformSupportVert(B, -axis, envelope), axis);
+    return minB > maxA;
+}
+
+bool ChNarrowphase::Dispatch_Cached(uint index,
+                                    uint icoll,
+                                    uint ID_A,
+                                    uint ID_B,
+                                    const ConvexBase* A,
+                                    const ConvexBase* B) {
+    pair_cache_hit[index] = 0;
+    pair_axis[index] = real3(0);
+
+    // Pairs involving mesh triangles are not cached
+    if (!pair_triangles.empty() && (pair_triangles[index].x >= 0 || pair_triangles[index].y >= 0))
+        return false;
+
+    long long shape_pair = cd_data->pair_shapeIDs[index];
+    auto entry = std::lower_bound(pair_cache.begin(), pair_cache.end(), shape_pair,
+                                  [](const PairCacheEntry& e, long long p) { return e.shape_pair < p; });
+    if (entry == pair_cache.end() || entry->shape_pair != shape_pair)
+        return false;
+
+    // Early-out if the shapes are still separated along the cached separating axis
+    if (entry->num_contacts == 0) {
+        if (entry->axis == real3(0) || !Separated(A, B, entry->axis, cd_data->collision_envelope))
+            return false;
+        pair_cache_hit[index] = 1;
+        pair_axis[index] = entry->axis;
+        return true;
+    }
+
+    if (entry->num_contacts > (int)(contact_index[index + 1] - contact_index[index]))
+        return false;
+
+    // Bound on the motion of any point of shape B relative to shape A (translation plus rotation about the origin of
+    // shape B, times the distance from this origin to the farthest corner of the AABB of shape B)
+    real3 rel_pos;
+    quaternion rel_rot;
+    RelativePose(A, B, rel_pos, rel_rot);
+    quaternion drot = Mult(Inv(entry->rel_rot), rel_rot);
+    real angle = 2 * Length(real3(drot.x, drot.y, drot.z));
+    if (angle > 0 || !(rel_pos == entry->rel_pos)) {
+        uint shapeB = uint(shape_pair & 0xffffffff);
+        real3 hdim = 0.5 * (cd_data->aabb_max[shapeB] - cd_data->aabb_min[shapeB]);
+        real3 center = 0.5 * (cd_data->aabb_max[shapeB] + cd_data->aabb_min[shapeB]) + cd_data->global_origin;
+        real radius = Length(hdim) + Length(center - B->A());
+        if (Length(rel_pos - entry->rel_pos) + angle * radius > pair_cache_tolerance)
+            return false;
+    }
+
+    // Reuse the cached contacts, expressed in the current frame of shape A
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* depth = cd_data->dpth_rigid_rigid.data();
+    real* erad = cd_data->erad_rigid_rigid.data();
+    for (int i = 0; i < entry->num_contacts; i++) {
+        const ContactCacheEntry& contact = contact_cache[entry->first_contact + i];
+        norm[icoll + i] = Rotate(contact.norm, A->R());
+        ptA[icoll + i] = TransformLocalToParent(A->A(), A->R(), contact.ptA);
+        ptB[icoll + i] = TransformLocalToParent(A->A(), A->R(), contact.ptB);
+        depth[icoll + i] = contact.depth;
+        erad[icoll + i] = contact.erad;
+    }
+    Dispatch_Finalize(icoll, ID_A, ID_B, entry->num_contacts);
+    pair_cache_hit[index] = 1;
+
+    return true;
+}
+
+void ChNarrowphase::UpdatePairCache() {
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const real envelope = cd_data->collision_envelope;
+    int num_pairs = (int)num_potential_rigid_contacts;
+
+    // Flag the pairs which are not cached (pairs involving mesh triangles and pairs processed in batches)
+    std::vector<char> skip(num_pairs, 0);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        if (!pair_triangles.empty() && (pair_triangles[index].x >= 0 || pair_triangles[index].y >= 0))
+            skip[index] = 1;
+        if (!pair_batched.empty() && pair_batched[index] >= 0)
+            skip[index] = 1;
+    }
+
+    // Count the cached contacts for each pair
+    std::vector<uint> num_contacts(num_pairs + 1);
+    num_contacts[num_pairs] = 0;
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        uint count = 0;
+        if (!skip[index]) {
+            for (uint i = contact_index[index]; i < contact_index[index + 1] && contact_rigid_active[i]; i++)
+                count++;
+        }
+        num_contacts[index] = count;
+    }
+
+    Thrust_Exclusive_Scan(num_contacts);
+
+    pair_cache.resize(num_pairs);
+    contact_cache.resize(num_contacts.back());
+
+    uint num_hits = 0;
+
+#pragma omp parallel for reduction(+ : num_hits)
+    for (int index = 0; index < num_pairs; index++) {
+        PairCacheEntry& entry = pair_cache[index];
+        num_hits += pair_cache_hit[index];
+
+        if (skip[index]) {
+            entry.shape_pair = -1;
+            continue;
+        }
+
+        entry.shape_pair = pair_shapeIDs[index];
+        ConvexShape shapeA(int(entry.shape_pair >> 32), &cd_data->shape_data);
+        ConvexShape shapeB(int(entry.shape_pair & 0xffffffff), &cd_data->shape_data);
+        RelativePose(&shapeA, &shapeB, entry.rel_pos, entry.rel_rot);
+        entry.num_contacts = int(num_contacts[index + 1] - num_contacts[index]);
+        entry.first_contact = int(num_contacts[index]);
+        entry.axis = real3(0);
+
+        if (entry.num_contacts == 0) {
+            // Keep a valid separating axis from the cache, or try the direction between the shape origins
+            if (!(pair_axis[index] == real3(0))) {
+                entry.axis = pair_axis[index];
+            } else {
+                real3 axis = shapeB.A() - shapeA.A();
+                real length = Length(axis);
+                if (length > 0 && Separated(&shapeA, &shapeB, axis / length, envelope))
+                    entry.axis = axis / length;
+            }
+            continue;
+        }
+
+        // Store the contacts in the frame of shape A
+        real3 pos = shapeA.A();
+        quaternion rot = shapeA.R();
+        uint icoll = contact_index[index];
+        for (int i = 0; i < entry.num_contacts; i++) {
+            ContactCacheEntry& contact = contact_cache[entry.first_contact + i];
+            contact.norm = RotateT(cd_data->norm_rigid_rigid[icoll + i], rot);
+            contact.ptA = TransformParentToLocal(pos, rot, cd_data->cpta_rigid_rigid[icoll + i]);
+            contact.ptB = TransformParentToLocal(pos, rot, cd_data->cptb_rigid_rigid[icoll + i]);
+            contact.depth = cd_data->dpth_rigid_rigid[icoll + i];
+            contact.erad = cd_data->erad_rigid_rigid[icoll + i];
+        }
+    }
+
+    num_cached_pairs = num_hits;
+
+    // Sort the cache entries by shape pair, for lookup at the next step
+    pair_cache.erase(std::remove_if(pair_cache.begin(), pair_cache.end(),
+                                    [](const PairCacheEntry& e) { return e.shape_pair < 0; }),
+                     pair_cache.end());
+    std::sort(pair_cache.begin(), pair_cache.end(),
+              [](const PairCacheEntry& e1, const PairCacheEntry& e2) { return e1.shape_pair < e2.shape_pair; });
+}
+
 void ChNarrowphase::DispatchMPR() {
     const real envelope = cd_data->collision_envelope;
     std::vector<real3>& norm = cd_data->norm_rigid_rigid;
@@ -241,16 +612,23 @@ void ChNarrowphase::DispatchMPR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triA;
+    ConvexShapeTriangle triB;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triA, triB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* A;
+        const ConvexBase* B;
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &triA, &triB, A, B);
 
-        if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+        if (use_pair_cache && Dispatch_Cached(index, icoll, ID_A, ID_B, A, B))
+            continue;
+
+        if (MPRCollision(A, B, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             // The number of contacts reported by MPR is always 1.
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
@@ -268,16 +646,26 @@ void ChNarrowphase::DispatchPRIMS() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triA;
+    ConvexShapeTriangle triB;
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triA, triB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* A;
+        const ConvexBase* B;
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &triA, &triB, A, B);
+
+        if (!pair_batched.empty() && pair_batched[index] >= 0)
+            continue;
+
+        if (use_pair_cache && Dispatch_Cached(index, icoll, ID_A, ID_B, A, B))
+            continue;
 
-        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
+        if (PRIMSCollision(A, B, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
                            &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
         }
@@ -294,21 +682,31 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triA;
+    ConvexShapeTriangle triB;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triA, triB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* A;
+        const ConvexBase* B;
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &triA, &triB, A, B);
+
+        if (!pair_batched.empty() && pair_batched[index] >= 0)
+            continue;
+
+        if (use_pair_cache && Dispatch_Cached(index, icoll, ID_A, ID_B, A, B))
+            continue;
 
-        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
+        if (PRIMSCollision(A, B, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
                            &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
-        } else if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+        } else if (MPRCollision(A, B, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
         }
@@ -329,6 +727,9 @@ void ChNarrowphase::ProcessRigidRigid() {
     std::vector<long long>& contact_shapeIDs = cd_data->contact_shapeIDs;
     uint& num_rigid_contacts = cd_data->num_rigid_contacts;
 
+    // Expand candidate pairs involving triangle meshes
+    ExpandMeshPairs();
+
     // Set maximum possible number of contacts for each potential collision
     // (depending on the narrowphase algorithm and on the types of shapes in
     // potential collision) and calculate the total number of potential contacts.
@@ -347,6 +748,16 @@ void ChNarrowphase::ProcessRigidRigid() {
     contact_rigid_active.resize(num_potentialContacts);
     thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), false);
 
+    if (use_pair_cache) {
+        pair_cache_hit.assign(num_potential_rigid_contacts, 0);
+        pair_axis.assign(num_potential_rigid_contacts, real3(0));
+    }
+
+    // Pairs involving spheres are processed in batches by the PRIMS and hybrid algorithms
+    pair_batched.clear();
+    if (algorithm == Algorithm::PRIMS || algorithm == Algorithm::HYBRID)
+        DispatchSphereBatches();
+
     switch (algorithm) {
         case Algorithm::MPR:
             DispatchMPR();
@@ -359,6 +770,10 @@ void ChNarrowphase::ProcessRigidRigid() {
             break;
     }
 
+    // Cache the results for all candidate pairs
+    if (use_pair_cache)
+        UpdatePairCache();
+
     // Calculate total number of actual (active) contacts
     num_rigid_contacts = (uint)Thrust_Count(contact_rigid_active, 1);
 
@@ -380,6 +795,169 @@ void ChNarrowphase::ProcessRigidRigid() {
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
     contact_shapeIDs.resize(num_rigid_contacts);
+
+    // Reduce the number of contacts for each pair of bodies
+    num_reduced_contacts = 0;
+    if (use_contact_reduction)
+        ReduceContacts();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChNarrowphase::ReduceContacts() {
+    std::vector<real3>& norm_data = cd_data->norm_rigid_rigid;
+    std::vector<real3>& cpta_data = cd_data->cpta_rigid_rigid;
+    std::vector<real3>& cptb_data = cd_data->cptb_rigid_rigid;
+    std::vector<real>& dpth_data = cd_data->dpth_rigid_rigid;
+    std::vector<real>& erad_data = cd_data->erad_rigid_rigid;
+    std::vector<vec2>& bids_data = cd_data->bids_rigid_rigid;
+    std::vector<long long>& contact_shapeIDs = cd_data->contact_shapeIDs;
+    uint& num_rigid_contacts = cd_data->num_rigid_contacts;
+
+    const int max_contacts = reduction_max_contacts;
+    const int num_contacts = (int)num_rigid_contacts;
+    if (num_contacts <= max_contacts)
+        return;
+
+    // Group the contacts by body pair (contacts of a body pair are typically already contiguous)
+    std::vector<std::pair<long long, int>> order(num_contacts);
+#pragma omp parallel for
+    for (int i = 0; i < num_contacts; i++) {
+        long long pair = ((long long)bids_data[i].x << 32) | (long long)(uint)bids_data[i].y;
+        order[i] = std::make_pair(pair, i);
+    }
+    std::sort(order.begin(), order.end());
+
+    // Find the body pairs with more contacts than the maximum
+    std::vector<int> group_start;
+    for (int i = 0; i < num_contacts;) {
+        int j = i + 1;
+        while (j < num_contacts && order[j].first == order[i].first)
+            j++;
+        if (j - i > max_contacts)
+            group_start.push_back(i);
+        i = j;
+    }
+    if (group_start.empty())
+        return;
+
+    contact_rigid_active.assign(num_contacts, true);
+
+    const int num_groups = (int)group_start.size();
+#pragma omp parallel for schedule(dynamic)
+    for (int ig = 0; ig < num_groups; ig++) {
+        int start = group_start[ig];
+        int end = start + 1;
+        while (end < num_contacts && order[end].first == order[start].first)
+            end++;
+
+        // Cluster the contacts of this body pair by their normals
+        std::vector<int> cluster(end - start);
+        std::vector<real3> cluster_norm;
+        for (int i = start; i < end; i++) {
+            const real3& n = norm_data[order[i].second];
+            int c = 0;
+            while (c < (int)cluster_norm.size() && Dot(n, cluster_norm[c]) < reduction_cos_angle)
+                c++;
+            if (c == (int)cluster_norm.size())
+                cluster_norm.push_back(n);
+            cluster[i - start] = c;
+        }
+
+        std::vector<int> members;
+        std::vector<int> reps;
+        std::vector<real> min_dist2;
+        std::vector<real> depth_sum;
+        std::vector<int> depth_count;
+        for (int c = 0; c < (int)cluster_norm.size(); c++) {
+            members.clear();
+            for (int i = start; i < end; i++) {
+                if (cluster[i - start] == c)
+                    members.push_back(order[i].second);
+            }
+            int num_members = (int)members.size();
+            if (num_members <= max_contacts)
+                continue;
+
+            // Project a contact point onto the tangent plane of this cluster
+            const real3& n = cluster_norm[c];
+            auto tangent = [&](int k) {
+                const real3& p = cpta_data[k];
+                return p - Dot(p, n) * n;
+            };
+
+            // Select the deepest contact, then repeatedly the contact farthest from all selected contacts
+            int deepest = 0;
+            for (int m = 1; m < num_members; m++) {
+                if (dpth_data[members[m]] < dpth_data[members[deepest]])
+                    deepest = m;
+            }
+            reps.assign(1, deepest);
+            min_dist2.assign(num_members, C_REAL_MAX);
+            while ((int)reps.size() < max_contacts) {
+                real3 p = tangent(members[reps.back()]);
+                int farthest = -1;
+                real max_dist2 = 0;
+                for (int m = 0; m < num_members; m++) {
+                    min_dist2[m] = Min(min_dist2[m], Length2(tangent(members[m]) - p));
+                    if (min_dist2[m] > max_dist2) {
+                        max_dist2 = min_dist2[m];
+                        farthest = m;
+                    }
+                }
+                if (farthest < 0)
+                    break;
+                reps.push_back(farthest);
+            }
+
+            // Assign each contact to the nearest representative and average the depths
+            int num_reps = (int)reps.size();
+            depth_sum.assign(num_reps, 0);
+            depth_count.assign(num_reps, 0);
+            for (int m = 0; m < num_members; m++) {
+                real3 p = tangent(members[m]);
+                int nearest = 0;
+                real nearest_dist2 = C_REAL_MAX;
+                for (int r = 0; r < num_reps; r++) {
+                    real dist2 = Length2(tangent(members[reps[r]]) - p);
+                    if (dist2 < nearest_dist2) {
+                        nearest_dist2 = dist2;
+                        nearest = r;
+                    }
+                }
+                depth_sum[nearest] += dpth_data[members[m]];
+                depth_count[nearest]++;
+                contact_rigid_active[members[m]] = false;
+            }
+            for (int r = 0; r < num_reps; r++) {
+                int k = members[reps[r]];
+                contact_rigid_active[k] = true;
+                dpth_data[k] = depth_sum[r] / depth_count[r];
+                cptb_data[k] = cpta_data[k] + dpth_data[k] * norm_data[k];
+            }
+        }
+    }
+
+    // Remove the discarded contacts
+    uint num_active = (uint)Thrust_Count(contact_rigid_active, 1);
+    num_reduced_contacts = num_rigid_contacts - num_active;
+    num_rigid_contacts = num_active;
+
+    thrust::remove_if(
+        THRUST_PAR thrust::make_zip_iterator(thrust::make_tuple(norm_data.begin(), cpta_data.begin(), cptb_data.begin(),
+                                                                dpth_data.begin(), erad_data.begin(), bids_data.begin(),
+                                                                contact_shapeIDs.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(norm_data.end(), cpta_data.end(), cptb_data.end(), dpth_data.end(),
+                                                     erad_data.end(), bids_data.end(), contact_shapeIDs.end())),
+        contact_rigid_active.begin(), thrust::logical_not<bool>());
+
+    norm_data.resize(num_rigid_contacts);
+    cpta_data.resize(num_rigid_contacts);
+    cptb_data.resize(num_rigid_contacts);
+    dpth_data.resize(num_rigid_contacts);
+    erad_data.resize(num_rigid_contacts);
+    bids_data.resize(num_rigid_contacts);
+    contact_shapeIDs.resize(num_rigid_contacts);
 }
 
 // -----------------------------------------------------------------------------
@@ -529,6 +1107,7 @@ void ChNarrowphase::ProcessRigidFluid() {
     real3 global_origin = cd_data->global_origin;
     real3 inv_bin_size = cd_data->inv_bin_size;
     const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<int>& obj_data_T = cd_data->shape_data.typ_rigid;
     const real radius = sphere_radius;
 
     uint total_bins = (bins_per_axis.x + 1) * (bins_per_axis.y + 1) * (bins_per_axis.z + 1);
@@ -596,6 +1175,28 @@ void ChNarrowphase::ProcessRigidFluid() {
     contact_counts.resize(num_spheres + 1);
 
     Thrust_Fill(contact_counts, 0);
+
+    // Collide a rigid shape (or mesh triangle) of body 'bodyA' with fluid particle 'p' and record the contact, if any
+    auto collide_rigid_fluid = [&](const ConvexBase* shapeA, const ConvexBase* shapeB, uint bodyA, uint p) {
+        uint k = p * max_rigid_neighbors + contact_counts[p];
+        real3 ptA, ptB, norm;
+        real depth, erad = 0;
+        int nC = 0;
+        if (PRIMSCollision(shapeA, shapeB, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad, nC)) {
+            if (nC == 1) {
+                neighbor_rigid_sphere[k] = bodyA;
+                norm_rigid_sphere[k] = norm;
+                cpta_rigid_sphere[k] = ptA;
+                dpth_rigid_sphere[k] = depth;
+                contact_counts[p]++;
+            }
+        } else if (MPRCollision(shapeA, shapeB, envelope, norm_rigid_sphere[k], cpta_rigid_sphere[k], ptB,
+                                dpth_rigid_sphere[k])) {
+            neighbor_rigid_sphere[k] = bodyA;
+            contact_counts[p]++;
+        }
+    };
+
     // For each rigid bin
     for (int index = 0; index < (signed)f_number_of_bins_active; index++) {
         uint bin_number = f_bin_number_out[index];
@@ -625,27 +1226,23 @@ void ChNarrowphase::ProcessRigidFluid() {
                         if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size, bins_per_axis, bin_number) == true) {
                             if (overlap(Amin, Amax, Bmin, Bmax) && collide(family, fam_data[shape_id_a])) {
                                 ConvexShape* shapeA = new ConvexShape(shape_id_a, &cd_data->shape_data);
-                                real3 ptA, ptB, norm;
-                                real depth, erad = 0;
-                                int nC = 0;
-                                if (PRIMSCollision(shapeA, shapeB, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad,
-                                                   nC)) {
-                                    if (nC == 1) {
-                                        uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
-                                        neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
-                                        norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = norm;
-                                        cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = ptA;
-                                        dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = depth;
-                                        contact_counts[p]++;
+                                uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
+                                if (obj_data_T[shape_id_a] == ChCollisionShape::Type::TRIANGLEMESH) {
+                                    // Collide with the mesh triangles overlapping the fluid particle
+                                    real3 local_min, local_max;
+                                    MeshLocalAABB(Bmin + global_origin, Bmax + global_origin, shapeA->A(),
+                                                  shapeA->R(), 0, local_min, local_max);
+                                    std::vector<int> overlaps;
+                                    shapeA->Mesh()->FindOverlaps(local_min, local_max, overlaps);
+                                    ConvexShapeTriangle triA;
+                                    for (auto t : overlaps) {
+                                        if (contact_counts[p] >= max_rigid_neighbors)
+                                            break;
+                                        SetMeshTriangle(shapeA, t, &triA);
+                                        collide_rigid_fluid(&triA, shapeB, bodyA, p);
                                     }
-                                } else if (MPRCollision(
-                                               shapeA, shapeB, envelope,
-                                               norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]],
-                                               cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]], ptB,
-                                               dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]])) {
-                                    uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
-                                    neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
-                                    contact_counts[p]++;
+                                } else {
+                                    collide_rigid_fluid(shapeA, shapeB, bodyA, p);
                                 }
                                 delete shapeA;
                             }
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
 #include "chrono/collision/chrono/ChConvexShape.h"
@@ -44,6 +46,8 @@ namespace collision {
 /// rcyl     |                                              N        N
 /// trimesh  |                                                       N
 /// </pre>
+/// Shapes of type TRIANGLEMESH are processed one triangle at a time, using the per-mesh BVH to find the triangles
+/// overlapping the other shape in a candidate pair.
 class ChApi ChNarrowphase {
   public:
     /// Narrowphase algorithm
@@ -103,6 +107,41 @@ class ChApi ChNarrowphase {
                                int& nC                    ///< [output] number of contacts found
     );
 
+    /// Enable the persistent pair cache (default: false).
+    /// If enabled, the narrowphase results for each candidate pair of shapes are cached across time steps. A pair with
+    /// no contacts at the previous step is skipped as long as the two shapes remain separated along the cached
+    /// separating axis (an exact test). The contacts of a pair in contact at the previous step are reused, after
+    /// transforming them with the current pose of the first shape, if no point of the second shape moved, relative to
+    /// the first shape, by more than the specified tolerance. With the default zero tolerance, contacts are reused
+    /// only if the relative pose of the two shapes did not change at all (e.g., for fixed or sleeping bodies). Pairs
+    /// involving triangle meshes are not cached.
+    void EnablePairCache(bool val, real tolerance = 0);
+
+    /// Delete all cached pair data.
+    void ClearPairCache();
+
+    /// Update the shape IDs in the pair cache after deletion of shapes.
+    /// The new ID of each current shape is given by the (order-preserving) map new_shape, with -1 for deleted shapes.
+    /// Cached pairs involving a deleted shape are discarded.
+    void RemapPairCache(const std::vector<int>& new_shape);
+
+    /// Return the number of candidate pairs resolved from the pair cache during the last call to Process().
+    uint GetNumCachedPairs() const { return num_cached_pairs; }
+
+    /// Enable reduction of the rigid-rigid contacts (default: false).
+    /// If enabled, the contacts generated by the narrowphase for each pair of bodies are clustered by their normals
+    /// (contacts with normals within the specified angle of each other belonging to the same cluster) and, in each
+    /// cluster with more than the specified maximum number of contacts, only that many representative contacts are
+    /// kept: the deepest contact and the contacts farthest apart from the already selected ones, in the tangent plane.
+    /// Each discarded contact is assigned to the nearest representative contact, whose depth is replaced with the
+    /// average depth of all contacts it represents (i.e., weighted by the contact area it stands for). This
+    /// drastically reduces the number of contacts generated by resting contacts between flat faces of triangle meshes
+    /// and convex hulls.
+    void EnableContactReduction(bool val, int max_contacts = 4, real max_angle = real(CH_C_PI / 12));
+
+    /// Return the number of contacts removed by contact reduction during the last call to Process().
+    uint GetNumReducedContacts() const { return num_reduced_contacts; }
+
     /// Set the fictitious radius of curvature used for collision with a corner or an edge.
     static void SetDefaultEdgeRadius(real radius);
 
@@ -116,6 +155,10 @@ class ChApi ChNarrowphase {
     /// Calculate total number of potential contacts.
     int PreprocessCount();
 
+    /// Replace each candidate pair involving a triangle mesh shape with one pair for each mesh triangle (or pair of
+    /// triangles, if both shapes are meshes) whose AABB overlaps the AABB of the other shape.
+    void ExpandMeshPairs();
+
     /// Transform the shape data to the global reference frame.
     /// Perform this as a preprocessing step to improve performance. Performance is improved because the amount of data
     /// loaded is still the same but it does not have to be transformed per contact pair, now it is transformed once per
@@ -133,15 +176,59 @@ class ChApi ChNarrowphase {
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
-    void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
+    void Dispatch_Init(uint index,
+                       uint& icoll,
+                       uint& ID_A,
+                       uint& ID_B,
+                       ConvexShape* shapeA,
+                       ConvexShape* shapeB,
+                       ConvexShapeTriangle* triA,
+                       ConvexShapeTriangle* triB,
+                       const ConvexBase*& A,
+                       const ConvexBase*& B);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
+    /// Reduce the number of active rigid-rigid contacts for each pair of bodies (see EnableContactReduction).
+    void ReduceContacts();
+
+    /// Process all candidate pairs of sphere-sphere, sphere-box, and sphere-triangle type in SIMD batches and flag them
+    /// in pair_batched, so that they are skipped by the PRIMS and hybrid dispatch functions.
+    void DispatchSphereBatches();
+
+    /// Resolve a candidate pair using the pair cache, if possible. Return true if the shapes are known to be
+    /// separated or if the cached contacts were reused (see EnablePairCache).
+    bool Dispatch_Cached(uint index, uint icoll, uint ID_A, uint ID_B, const ConvexBase* A, const ConvexBase* B);
+
+    /// Store the narrowphase results for all candidate pairs in the pair cache, for use at the next step.
+    void UpdatePairCache();
+
+    /// Cached narrowphase results for a pair of shapes, persistent across time steps.
+    struct PairCacheEntry {
+        long long shape_pair;  ///< shape IDs (encoded in a single long long)
+        real3 rel_pos;         ///< position of the second shape in the frame of the first shape
+        quaternion rel_rot;    ///< rotation of the second shape relative to the first shape
+        real3 axis;            ///< separating axis (global frame), zero if unknown or if the shapes are in contact
+        int num_contacts;      ///< number of contacts
+        int first_contact;     ///< index of first contact in the contact cache
+    };
+
+    /// Cached contact, expressed in the frame of the first shape.
+    struct ContactCacheEntry {
+        real3 norm;  ///< contact normal
+        real3 ptA;   ///< contact point on first shape
+        real3 ptB;   ///< contact point on second shape
+        real depth;  ///< penetration depth
+        real erad;   ///< effective contact radius
+    };
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     std::vector<char> contact_rigid_active;
     std::vector<char> contact_rigid_fluid_active;
     std::vector<char> contact_fluid_active;
     std::vector<uint> contact_index;
+    std::vector<vec2> pair_triangles;   ///< mesh triangles for each candidate pair (-1 if not a mesh shape)
+    std::vector<int8_t> pair_batched;  ///< batch group of each candidate pair (-1 if not processed in batches)
 
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
@@ -149,6 +236,19 @@ class ChApi ChNarrowphase {
 
     Algorithm algorithm;
 
+    bool use_pair_cache;                           ///< enable caching of pair results across steps
+    real pair_cache_tolerance;                     ///< maximum relative motion for reusing cached contacts
+    std::vector<PairCacheEntry> pair_cache;        ///< cached pair results, sorted by shape pair
+    std::vector<ContactCacheEntry> contact_cache;  ///< cached contacts
+    std::vector<char> pair_cache_hit;              ///< [num_potential_rigid_contacts] pair resolved from cache
+    std::vector<real3> pair_axis;                  ///< [num_potential_rigid_contacts] separating axis for each pair
+    uint num_cached_pairs;                         ///< number of pairs resolved from cache at the last step
+
+    bool use_contact_reduction;   ///< enable reduction of contacts per body pair
+    int reduction_max_contacts;   ///< maximum number of contacts per body pair and normal cluster
+    real reduction_cos_angle;     ///< cosine of the maximum angle between normals in a cluster
+    uint num_reduced_contacts;    ///< number of contacts removed at the last step
+
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
     std::vector<uint> f_bin_number_out;  //// TODO: rename to f_bin_active
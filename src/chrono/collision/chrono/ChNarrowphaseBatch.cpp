@@ -0,0 +1,556 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Batched narrowphase for candidate pairs involving spheres.
+// Candidate pairs are grouped by type combination (sphere-sphere, sphere-box,
+// sphere-triangle). Within each group, pairs are processed in blocks: the shape
+// data of a block of pairs is gathered in structure-of-arrays form and the
+// contact test is evaluated for all pairs in the block at once (4 pairs per AVX
+// instruction in double precision, if SIMD is enabled; one pair at a time
+// otherwise). The kernels are branch-free versions of sphere_sphere, box_sphere,
+// and triangle_sphere (see ChNarrowphasePRIMS.cpp) and produce the same contacts.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/collision/ChCollisionModel.h"
+#include "chrono/collision/chrono/ChNarrowphase.h"
+#include "chrono/collision/chrono/ChCollisionUtils.h"
+
+#include "chrono/multicore_math/simd.h"
+#if defined(USE_AVX)
+    #include "chrono/multicore_math/simd_avx.h"
+#endif
+
+namespace chrono {
+namespace collision {
+
+using namespace chrono::collision::ch_utils;
+
+// -----------------------------------------------------------------------------
+// Operations on packs of real values (one value per pair in a block).
+// Comparison results are masks, to be used with PackSelect and PackLane.
+
+#if defined(USE_AVX)
+
+typedef __m256d pack;
+static const int pack_width = 4;
+
+static inline pack PackSet(real a) {
+    return _mm256_set1_pd(a);
+}
+static inline pack PackLoad(const real* a) {
+    return _mm256_loadu_pd(a);
+}
+static inline void PackStore(real* a, pack v) {
+    _mm256_storeu_pd(a, v);
+}
+static inline pack PackAdd(pack a, pack b) {
+    return simd::Add(a, b);
+}
+static inline pack PackSub(pack a, pack b) {
+    return simd::Sub(a, b);
+}
+static inline pack PackMul(pack a, pack b) {
+    return simd::Mul(a, b);
+}
+static inline pack PackDiv(pack a, pack b) {
+    return simd::Div(a, b);
+}
+static inline pack PackSqrt(pack a) {
+    return simd::SquareRoot(a);
+}
+static inline pack PackMin(pack a, pack b) {
+    return simd::Min(a, b);
+}
+static inline pack PackMax(pack a, pack b) {
+    return simd::Max(a, b);
+}
+static inline pack PackLess(pack a, pack b) {
+    return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+}
+static inline pack PackLessEq(pack a, pack b) {
+    return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+}
+static inline pack PackAnd(pack a, pack b) {
+    return _mm256_and_pd(a, b);
+}
+static inline pack PackOr(pack a, pack b) {
+    return _mm256_or_pd(a, b);
+}
+static inline pack PackSelect(pack mask, pack a, pack b) {
+    return _mm256_blendv_pd(b, a, mask);
+}
+static inline bool PackLane(pack mask, int lane) {
+    return ((_mm256_movemask_pd(mask) >> lane) & 1) != 0;
+}
+
+#else
+
+typedef real pack;
+static const int pack_width = 1;
+
+static inline pack PackSet(real a) {
+    return a;
+}
+static inline pack PackLoad(const real* a) {
+    return *a;
+}
+static inline void PackStore(real* a, pack v) {
+    *a = v;
+}
+static inline pack PackAdd(pack a, pack b) {
+    return a + b;
+}
+static inline pack PackSub(pack a, pack b) {
+    return a - b;
+}
+static inline pack PackMul(pack a, pack b) {
+    return a * b;
+}
+static inline pack PackDiv(pack a, pack b) {
+    return a / b;
+}
+static inline pack PackSqrt(pack a) {
+    return Sqrt(a);
+}
+static inline pack PackMin(pack a, pack b) {
+    return a < b ? a : b;
+}
+static inline pack PackMax(pack a, pack b) {
+    return a > b ? a : b;
+}
+static inline pack PackLess(pack a, pack b) {
+    return a < b ? real(1) : real(0);
+}
+static inline pack PackLessEq(pack a, pack b) {
+    return a <= b ? real(1) : real(0);
+}
+static inline pack PackAnd(pack a, pack b) {
+    return (a != 0 && b != 0) ? real(1) : real(0);
+}
+static inline pack PackOr(pack a, pack b) {
+    return (a != 0 || b != 0) ? real(1) : real(0);
+}
+static inline pack PackSelect(pack mask, pack a, pack b) {
+    return mask != 0 ? a : b;
+}
+static inline bool PackLane(pack mask, int lane) {
+    return mask != 0;
+}
+
+#endif
+
+// 3D vectors of packs.
+struct pack3 {
+    pack x, y, z;
+};
+
+static inline pack3 Pack3(pack x, pack y, pack z) {
+    pack3 r = {x, y, z};
+    return r;
+}
+static inline pack3 Pack3Load(const real* x, const real* y, const real* z) {
+    return Pack3(PackLoad(x), PackLoad(y), PackLoad(z));
+}
+static inline void Pack3Store(real* x, real* y, real* z, const pack3& v) {
+    PackStore(x, v.x);
+    PackStore(y, v.y);
+    PackStore(z, v.z);
+}
+static inline pack3 Pack3Add(const pack3& a, const pack3& b) {
+    return Pack3(PackAdd(a.x, b.x), PackAdd(a.y, b.y), PackAdd(a.z, b.z));
+}
+static inline pack3 Pack3Sub(const pack3& a, const pack3& b) {
+    return Pack3(PackSub(a.x, b.x), PackSub(a.y, b.y), PackSub(a.z, b.z));
+}
+static inline pack3 Pack3Scale(const pack3& a, pack s) {
+    return Pack3(PackMul(a.x, s), PackMul(a.y, s), PackMul(a.z, s));
+}
+static inline pack3 Pack3Div(const pack3& a, pack s) {
+    return Pack3(PackDiv(a.x, s), PackDiv(a.y, s), PackDiv(a.z, s));
+}
+static inline pack Pack3Dot(const pack3& a, const pack3& b) {
+    return PackAdd(PackAdd(PackMul(a.x, b.x), PackMul(a.y, b.y)), PackMul(a.z, b.z));
+}
+static inline pack3 Pack3Cross(const pack3& a, const pack3& b) {
+    return Pack3(PackSub(PackMul(a.y, b.z), PackMul(a.z, b.y)), PackSub(PackMul(a.z, b.x), PackMul(a.x, b.z)),
+                 PackSub(PackMul(a.x, b.y), PackMul(a.y, b.x)));
+}
+static inline pack3 Pack3Select(pack mask, const pack3& a, const pack3& b) {
+    return Pack3(PackSelect(mask, a.x, b.x), PackSelect(mask, a.y, b.y), PackSelect(mask, a.z, b.z));
+}
+
+// Rotate a vector by the quaternion (w, u) (see Rotate in real4.cpp).
+static inline pack3 Pack3Rotate(const pack3& v, pack w, const pack3& u) {
+    pack3 t = Pack3Scale(Pack3Cross(u, v), PackSet(2));
+    return Pack3Add(Pack3Add(v, Pack3Scale(t, w)), Pack3Cross(u, t));
+}
+
+// -----------------------------------------------------------------------------
+// Structure-of-arrays data for one block of candidate pairs.
+
+struct PairBlock {
+    int num_pairs;          // number of valid lanes
+    int index[pack_width];  // candidate pair index for each lane
+    real swap[pack_width];  // 1 if the sphere is the first shape in the candidate pair, 0 otherwise
+
+    // Sphere
+    real sx[pack_width], sy[pack_width], sz[pack_width], sr[pack_width];
+
+    // Other shape: position (sphere, box) or first triangle vertex
+    real px[pack_width], py[pack_width], pz[pack_width];
+    // Other shape: sphere radius, box rotation, or second triangle vertex
+    real qw[pack_width], qx[pack_width], qy[pack_width], qz[pack_width];
+    // Other shape: box half-dimensions or third triangle vertex
+    real hx[pack_width], hy[pack_width], hz[pack_width];
+
+    // Contact data (with the other shape as first shape, as in box_sphere and triangle_sphere)
+    real nx[pack_width], ny[pack_width], nz[pack_width];
+    real ax[pack_width], ay[pack_width], az[pack_width];
+    real bx[pack_width], by[pack_width], bz[pack_width];
+    real depth[pack_width], erad[pack_width];
+    bool hit[pack_width];
+};
+
+static void SetContact(PairBlock& block,
+                       pack hit,
+                       const pack3& norm,
+                       const pack3& pt1,
+                       const pack3& pt2,
+                       pack depth,
+                       pack erad) {
+    Pack3Store(block.nx, block.ny, block.nz, norm);
+    Pack3Store(block.ax, block.ay, block.az, pt1);
+    Pack3Store(block.bx, block.by, block.bz, pt2);
+    PackStore(block.depth, depth);
+    PackStore(block.erad, erad);
+    for (int l = 0; l < pack_width; l++)
+        block.hit[l] = PackLane(hit, l);
+}
+
+// Sphere-sphere kernel (see sphere_sphere). The other sphere has center p and radius qw.
+static void SphereSphereKernel(PairBlock& block, real separation) {
+    pack3 pos1 = Pack3Load(block.px, block.py, block.pz);
+    pack3 pos2 = Pack3Load(block.sx, block.sy, block.sz);
+    pack radius1 = PackLoad(block.qw);
+    pack radius2 = PackLoad(block.sr);
+
+    pack3 delta = Pack3Sub(pos2, pos1);
+    pack dist2 = Pack3Dot(delta, delta);
+    pack radSum = PackAdd(radius1, radius2);
+    pack radSum_s = PackAdd(radSum, PackSet(separation));
+    pack hit = PackAnd(PackLess(dist2, PackMul(radSum_s, radSum_s)), PackLessEq(PackSet(real(1e-12)), dist2));
+
+    pack dist = PackSqrt(dist2);
+    pack3 norm = Pack3Div(delta, dist);
+    pack3 pt1 = Pack3Add(pos1, Pack3Scale(norm, radius1));
+    pack3 pt2 = Pack3Sub(pos2, Pack3Scale(norm, radius2));
+    pack depth = PackSub(dist, radSum);
+    pack erad = PackDiv(PackMul(radius1, radius2), radSum);
+
+    SetContact(block, hit, norm, pt1, pt2, depth, erad);
+}
+
+// Box-sphere kernel (see box_sphere). The box has center p, rotation q, and half-dimensions h.
+static void BoxSphereKernel(PairBlock& block, real separation, real edge_radius) {
+    pack3 pos1 = Pack3Load(block.px, block.py, block.pz);
+    pack w1 = PackLoad(block.qw);
+    pack3 u1 = Pack3Load(block.qx, block.qy, block.qz);
+    pack3 hdims1 = Pack3Load(block.hx, block.hy, block.hz);
+    pack3 pos2 = Pack3Load(block.sx, block.sy, block.sz);
+    pack radius2 = PackLoad(block.sr);
+
+    // Express the sphere position in the frame of the box and snap it to the surface of the box
+    pack3 minus_u1 = Pack3Scale(u1, PackSet(-1));
+    pack3 spherePos = Pack3Rotate(Pack3Sub(pos2, pos1), w1, minus_u1);
+    pack3 boxPos = Pack3(PackMin(PackMax(spherePos.x, PackSub(PackSet(0), hdims1.x)), hdims1.x),
+                         PackMin(PackMax(spherePos.y, PackSub(PackSet(0), hdims1.y)), hdims1.y),
+                         PackMin(PackMax(spherePos.z, PackSub(PackSet(0), hdims1.z)), hdims1.z));
+
+    // Number of snapped coordinates (1 if snapping to a face)
+    pack one = PackSet(1);
+    pack zero = PackSet(0);
+    pack snap_x = PackLess(hdims1.x, PackMax(spherePos.x, PackSub(zero, spherePos.x)));
+    pack snap_y = PackLess(hdims1.y, PackMax(spherePos.y, PackSub(zero, spherePos.y)));
+    pack snap_z = PackLess(hdims1.z, PackMax(spherePos.z, PackSub(zero, spherePos.z)));
+    pack num_snapped = PackAdd(PackAdd(PackSelect(snap_x, one, zero), PackSelect(snap_y, one, zero)),
+                               PackSelect(snap_z, one, zero));
+
+    pack3 delta = Pack3Sub(spherePos, boxPos);
+    pack dist2 = Pack3Dot(delta, delta);
+    pack radius2_s = PackAdd(radius2, PackSet(separation));
+    pack hit = PackAnd(PackLess(dist2, PackMul(radius2_s, radius2_s)), PackLess(PackSet(real(1e-12f)), dist2));
+
+    pack dist = PackSqrt(dist2);
+    pack depth = PackSub(dist, radius2);
+    pack3 norm = Pack3Rotate(Pack3Div(delta, dist), w1, u1);
+    pack3 pt1 = Pack3Add(pos1, Pack3Rotate(boxPos, w1, u1));
+    pack3 pt2 = Pack3Sub(pos2, Pack3Scale(norm, radius2));
+
+    pack edge = PackSet(edge_radius);
+    pack erad_edge = PackDiv(PackMul(radius2, edge), PackAdd(radius2, edge));
+    pack erad = PackSelect(PackAnd(PackLessEq(num_snapped, one), PackLessEq(one, num_snapped)), radius2, erad_edge);
+
+    SetContact(block, hit, norm, pt1, pt2, depth, erad);
+}
+
+// Triangle-sphere kernel (see triangle_sphere). The triangle has vertices p, q (w unused), and h.
+// The closest point on the triangle is found as in snap_to_triangle, evaluating all Voronoi regions and selecting the
+// result in reverse order of the tests in snap_to_triangle.
+static void TriangleSphereKernel(PairBlock& block, real separation, real edge_radius) {
+    pack3 A = Pack3Load(block.px, block.py, block.pz);
+    pack3 B = Pack3Load(block.qx, block.qy, block.qz);
+    pack3 C = Pack3Load(block.hx, block.hy, block.hz);
+    pack3 pos2 = Pack3Load(block.sx, block.sy, block.sz);
+    pack radius2 = PackLoad(block.sr);
+
+    pack zero = PackSet(0);
+    pack radius2_s = PackAdd(radius2, PackSet(separation));
+
+    // Face normal and signed height of the sphere center above the face plane
+    pack3 AB = Pack3Sub(B, A);
+    pack3 AC = Pack3Sub(C, A);
+    pack3 n = Pack3Cross(AB, AC);
+    pack3 nrm1 = Pack3Div(n, PackSqrt(Pack3Dot(n, n)));
+    pack h = Pack3Dot(Pack3Sub(pos2, A), nrm1);
+    pack hit = PackAnd(PackLess(h, radius2_s), PackLess(zero, h));
+
+    // Closest point on the triangle
+    pack3 AP = Pack3Sub(pos2, A);
+    pack d1 = Pack3Dot(AB, AP);
+    pack d2 = Pack3Dot(AC, AP);
+    pack3 BP = Pack3Sub(pos2, B);
+    pack d3 = Pack3Dot(AB, BP);
+    pack d4 = Pack3Dot(AC, BP);
+    pack3 CP = Pack3Sub(pos2, C);
+    pack d5 = Pack3Dot(AB, CP);
+    pack d6 = Pack3Dot(AC, CP);
+    pack vc = PackSub(PackMul(d1, d4), PackMul(d3, d2));
+    pack vb = PackSub(PackMul(d5, d2), PackMul(d1, d6));
+    pack va = PackSub(PackMul(d3, d6), PackMul(d5, d4));
+    pack d43 = PackSub(d4, d3);
+    pack d56 = PackSub(d5, d6);
+
+    pack inA = PackAnd(PackLessEq(d1, zero), PackLessEq(d2, zero));
+    pack inB = PackAnd(PackLessEq(zero, d3), PackLessEq(d4, d3));
+    pack inAB = PackAnd(PackAnd(PackLessEq(vc, zero), PackLessEq(zero, d1)), PackLessEq(d3, zero));
+    pack inC = PackAnd(PackLessEq(zero, d6), PackLessEq(d5, d6));
+    pack inAC = PackAnd(PackAnd(PackLessEq(vb, zero), PackLessEq(zero, d2)), PackLessEq(d6, zero));
+    pack inBC = PackAnd(PackAnd(PackLessEq(va, zero), PackLessEq(zero, d43)), PackLessEq(zero, d56));
+    pack on_edge = PackOr(PackOr(PackOr(inA, inB), PackOr(inAB, inC)), PackOr(inAC, inBC));
+
+    pack denom = PackDiv(PackSet(1), PackAdd(PackAdd(va, vb), vc));
+    pack3 faceLoc = Pack3Add(A, Pack3Add(Pack3Scale(AB, PackMul(vb, denom)), Pack3Scale(AC, PackMul(vc, denom))));
+    faceLoc = Pack3Select(inBC, Pack3Add(B, Pack3Scale(Pack3Sub(C, B), PackDiv(d43, PackAdd(d43, d56)))), faceLoc);
+    faceLoc = Pack3Select(inAC, Pack3Add(A, Pack3Scale(AC, PackDiv(d2, PackSub(d2, d6)))), faceLoc);
+    faceLoc = Pack3Select(inC, C, faceLoc);
+    faceLoc = Pack3Select(inAB, Pack3Add(A, Pack3Scale(AB, PackDiv(d1, PackSub(d1, d3)))), faceLoc);
+    faceLoc = Pack3Select(inB, B, faceLoc);
+    faceLoc = Pack3Select(inA, A, faceLoc);
+
+    // Contact with an edge or vertex
+    pack3 delta = Pack3Sub(pos2, faceLoc);
+    pack dist2 = Pack3Dot(delta, delta);
+    pack hit_edge = PackAnd(PackLess(dist2, PackMul(radius2_s, radius2_s)), PackLess(PackSet(real(1e-12f)), dist2));
+    pack dist = PackSqrt(dist2);
+    pack edge = PackSet(edge_radius);
+
+    hit = PackSelect(on_edge, PackAnd(hit, hit_edge), hit);
+    pack3 norm = Pack3Select(on_edge, Pack3Div(delta, dist), nrm1);
+    pack depth = PackSelect(on_edge, PackSub(dist, radius2), PackSub(h, radius2));
+    pack erad = PackSelect(on_edge, PackDiv(PackMul(radius2, edge), PackAdd(radius2, edge)), radius2);
+    pack3 pt2 = Pack3Sub(pos2, Pack3Scale(norm, radius2));
+
+    SetContact(block, hit, norm, faceLoc, pt2, depth, erad);
+}
+
+// -----------------------------------------------------------------------------
+
+// Type combinations processed in batches.
+enum BatchGroup { SPHERE_SPHERE, BOX_SPHERE, TRIANGLE_SPHERE, NUM_BATCH_GROUPS };
+
+void ChNarrowphase::DispatchSphereBatches() {
+    const std::vector<shape_type>& obj_data_T = cd_data->shape_data.typ_rigid;
+    const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const real separation = 2 * cd_data->collision_envelope;
+    const real edge_radius = GetDefaultEdgeRadius();
+    int num_pairs = (int)num_potential_rigid_contacts;
+
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* contactDepth = cd_data->dpth_rigid_rigid.data();
+    real* effective_radius = cd_data->erad_rigid_rigid.data();
+
+    // Classify the candidate pairs by type combination (-1 for pairs not processed in batches)
+    pair_batched.resize(num_pairs);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
+        shape_type type1 = obj_data_T[pair.x];
+        shape_type type2 = obj_data_T[pair.y];
+        if (!pair_triangles.empty()) {
+            if (pair_triangles[index].x >= 0)
+                type1 = ChCollisionShape::Type::TRIANGLE;
+            if (pair_triangles[index].y >= 0)
+                type2 = ChCollisionShape::Type::TRIANGLE;
+        }
+        if (type2 == ChCollisionShape::Type::SPHERE)
+            std::swap(type1, type2);
+
+        int8_t group = -1;
+        if (type1 == ChCollisionShape::Type::SPHERE) {
+            if (type2 == ChCollisionShape::Type::SPHERE)
+                group = SPHERE_SPHERE;
+            else if (type2 == ChCollisionShape::Type::BOX)
+                group = BOX_SPHERE;
+            else if (type2 == ChCollisionShape::Type::TRIANGLE)
+                group = TRIANGLE_SPHERE;
+        }
+        pair_batched[index] = group;
+    }
+
+    // Group the candidate pairs (counting sort)
+    std::vector<int> group_start(NUM_BATCH_GROUPS + 1, 0);
+    for (int index = 0; index < num_pairs; index++) {
+        if (pair_batched[index] >= 0)
+            group_start[pair_batched[index] + 1]++;
+    }
+    for (int g = 0; g < NUM_BATCH_GROUPS; g++)
+        group_start[g + 1] += group_start[g];
+    std::vector<int> group_pairs(group_start[NUM_BATCH_GROUPS]);
+    std::vector<int> pos(group_start.begin(), group_start.end() - 1);
+    for (int index = 0; index < num_pairs; index++) {
+        if (pair_batched[index] >= 0)
+            group_pairs[pos[pair_batched[index]]++] = index;
+    }
+
+    ConvexShape shape1;
+    ConvexShape shape2;
+    ConvexShapeTriangle tri1;
+    ConvexShapeTriangle tri2;
+
+    for (int g = 0; g < NUM_BATCH_GROUPS; g++) {
+        int group_size = group_start[g + 1] - group_start[g];
+        int num_blocks = (group_size + pack_width - 1) / pack_width;
+
+#pragma omp parallel for private(shape1, shape2, tri1, tri2)
+        for (int ib = 0; ib < num_blocks; ib++) {
+            PairBlock block;
+            block.num_pairs = std::min(pack_width, group_size - ib * pack_width);
+
+            // Gather the shape data for this block (replicating the last pair in unused lanes)
+            for (int l = 0; l < pack_width; l++) {
+                int index = group_pairs[group_start[g] + ib * pack_width + std::min(l, block.num_pairs - 1)];
+                block.index[l] = index;
+
+                uint icoll, ID_A, ID_B;
+                const ConvexBase* A;
+                const ConvexBase* B;
+                Dispatch_Init(index, icoll, ID_A, ID_B, &shape1, &shape2, &tri1, &tri2, A, B);
+
+                // Identify the sphere and the other shape
+                bool swap = (g != SPHERE_SPHERE && A->Type() == ChCollisionShape::Type::SPHERE);
+                const ConvexBase* sphere = swap ? A : B;
+                const ConvexBase* other = swap ? B : A;
+                block.swap[l] = swap ? 1 : 0;
+
+                real3 s = sphere->A();
+                block.sx[l] = s.x;
+                block.sy[l] = s.y;
+                block.sz[l] = s.z;
+                block.sr[l] = sphere->Radius();
+
+                if (g == TRIANGLE_SPHERE) {
+                    const real3* tri = other->Triangles();
+                    block.px[l] = tri[0].x;
+                    block.py[l] = tri[0].y;
+                    block.pz[l] = tri[0].z;
+                    block.qw[l] = 0;
+                    block.qx[l] = tri[1].x;
+                    block.qy[l] = tri[1].y;
+                    block.qz[l] = tri[1].z;
+                    block.hx[l] = tri[2].x;
+                    block.hy[l] = tri[2].y;
+                    block.hz[l] = tri[2].z;
+                } else {
+                    real3 p = other->A();
+                    block.px[l] = p.x;
+                    block.py[l] = p.y;
+                    block.pz[l] = p.z;
+                    if (g == SPHERE_SPHERE) {
+                        block.qw[l] = other->Radius();
+                        block.qx[l] = block.qy[l] = block.qz[l] = 0;
+                        block.hx[l] = block.hy[l] = block.hz[l] = 0;
+                    } else {
+                        quaternion q = other->R();
+                        real3 h = other->Box();
+                        block.qw[l] = q.w;
+                        block.qx[l] = q.x;
+                        block.qy[l] = q.y;
+                        block.qz[l] = q.z;
+                        block.hx[l] = h.x;
+                        block.hy[l] = h.y;
+                        block.hz[l] = h.z;
+                    }
+                }
+            }
+
+            switch (g) {
+                case SPHERE_SPHERE:
+                    SphereSphereKernel(block, separation);
+                    break;
+                case BOX_SPHERE:
+                    BoxSphereKernel(block, separation, edge_radius);
+                    break;
+                case TRIANGLE_SPHERE:
+                    TriangleSphereKernel(block, separation, edge_radius);
+                    break;
+            }
+
+            // Scatter the contacts (swapping the contact points and flipping the normal if the sphere is the first
+            // shape in the candidate pair)
+            for (int l = 0; l < block.num_pairs; l++) {
+                if (!block.hit[l])
+                    continue;
+                int index = block.index[l];
+                uint icoll = contact_index[index];
+                real3 n(block.nx[l], block.ny[l], block.nz[l]);
+                real3 pt1(block.ax[l], block.ay[l], block.az[l]);
+                real3 pt2(block.bx[l], block.by[l], block.bz[l]);
+                if (block.swap[l] != 0) {
+                    norm[icoll] = -n;
+                    ptA[icoll] = pt2;
+                    ptB[icoll] = pt1;
+                } else {
+                    norm[icoll] = n;
+                    ptA[icoll] = pt1;
+                    ptB[icoll] = pt2;
+                }
+                contactDepth[icoll] = block.depth[l];
+                effective_radius[icoll] = block.erad[l];
+
+                long long p = pair_shapeIDs[index];
+                Dispatch_Finalize(icoll, obj_data_ID[int(p >> 32)], obj_data_ID[int(p & 0xffffffff)], 1);
+            }
+        }
+    }
+}
+
+}  // end namespace collision
+}  // end namespace chrono
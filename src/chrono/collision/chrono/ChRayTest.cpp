@@ -12,7 +12,10 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <climits>
+
 #include "chrono/collision/chrono/ChRayTest.h"
+#include "chrono/collision/chrono/ChNarrowphase.h"
 #include "chrono/collision/chrono/ChCollisionUtils.h"
 
 // Always include ChConfig.h *before* any Thrust headers!
@@ -377,7 +380,7 @@ bool triangle_ray(const real3& A,
 
 // Use a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems", 1986)
 // to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
-bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
+bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info, int body_filter) {
     // Readability replacements
     const vec3& bins_per_axis = cd_data->bins_per_axis;
     const real3& bin_size = cd_data->bin_size;
@@ -386,6 +389,7 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     const real3& rtf = cd_data->max_bounding_point;
     const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
     const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
 
     // Calculate ray parameter at intersection of overall AABB. Return now if no intersection
     real3 center = 0.5 * (rtf + lbr), loc, normal;
@@ -393,6 +397,10 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     if (!aabb_ray(0.5 * (rtf - lbr), start - center, end - center, t_min, loc, normal))
         return false;
 
+    // With a BVH broadphase, traverse the hierarchy instead of the grid
+    if (cd_data->bvh_num_leaves > 0)
+        return CheckBVH(start, end, info, body_filter);
+
     // Ray direction
     real3 ray = end - start;
 
@@ -428,6 +436,7 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     ConvexShape shape(-1, &cd_data->shape_data);
     real mindist2 = C_REAL_MAX;
     bool hit = false;
+    int hit_shape = -1;
 
     ////std::cout << "Ray start: [" << start.x << "," << start.y << "," << start.z << "]" << std::endl;
     ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
@@ -442,16 +451,20 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         auto end_index = bin_start_index_ext[bin_index + 1];
 
         for (uint j = start_index; j < end_index; j++) {
-            num_shape_tests++;
             shape.index = bin_aabb_number[j];
+            if (body_filter >= 0 && id_rigid[shape.index] != (uint)body_filter)
+                continue;
+            num_shape_tests++;
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
+            if (CheckShape(shape, start, end, info.normal, mindist2)) {
                 hit = true;
+                hit_shape = shape.index;
+            }
         }
 
         // If a shape in the current bin was hit, stop.
         if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
+            info.shapeID = hit_shape;           // Identifier of closest hit shape
             info.dist = Sqrt(mindist2);         // Distance from ray origin
             info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
             info.point = start + info.t * ray;  // Intersection point
@@ -471,6 +484,112 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     return hit;
 }
 
+bool ChRayTest::CheckShapes(const real3& start, const real3& end, int first_shape, int num_shapes, RayHitInfo& info) {
+    ConvexShape shape(-1, &cd_data->shape_data);
+    real mindist2 = C_REAL_MAX;
+    int hit_shape = -1;
+
+    for (int i = first_shape; i < first_shape + num_shapes; i++) {
+        shape.index = i;
+        num_shape_tests++;
+        if (CheckShape(shape, start, end, info.normal, mindist2))
+            hit_shape = i;
+    }
+
+    if (hit_shape < 0)
+        return false;
+
+    real3 ray = end - start;
+    info.shapeID = hit_shape;           // Identifier of closest hit shape
+    info.dist = Sqrt(mindist2);         // Distance from ray origin
+    info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
+    info.point = start + info.t * ray;  // Intersection point
+    return true;
+}
+
+// Ray parameter at entry in an AABB (relative to the ray start point). Return false if the ray does not intersect the
+// AABB for a parameter in [0, t_max].
+static inline bool ray_aabb(const real3& ray, const real3& aabb_min, const real3& aabb_max, real t_max, real& t_entry) {
+    real t0 = 0;
+    real t1 = t_max;
+    for (int i = 0; i < 3; i++) {
+        if (ray[i] == 0) {
+            if (aabb_min[i] > 0 || aabb_max[i] < 0)
+                return false;
+            continue;
+        }
+        real ta = aabb_min[i] / ray[i];
+        real tb = aabb_max[i] / ray[i];
+        t0 = Max(t0, Min(ta, tb));
+        t1 = Min(t1, Max(ta, tb));
+        if (t0 > t1)
+            return false;
+    }
+    t_entry = t0;
+    return true;
+}
+
+// Traverse the broadphase BVH, testing the ray against the shapes of all leaves intersected by the ray and closer than
+// the closest hit found so far.
+bool ChRayTest::CheckBVH(const real3& start, const real3& end, RayHitInfo& info, int body_filter) {
+    const int n = cd_data->bvh_num_leaves;
+    const std::vector<uint>& bvh_shape = cd_data->bvh_shape;
+    const std::vector<vec2>& bvh_children = cd_data->bvh_children;
+    const std::vector<real3>& bvh_min = cd_data->bvh_min;
+    const std::vector<real3>& bvh_max = cd_data->bvh_max;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+
+    // Ray start point relative to the BVH origin and ray direction
+    real3 origin = start - cd_data->global_origin;
+    real3 ray = end - start;
+    real length = Length(ray);
+
+    ConvexShape shape(-1, &cd_data->shape_data);
+    real mindist2 = C_REAL_MAX;
+    real t_hit = 1;
+    int hit_shape = -1;
+
+    int stack[128];  // larger than the maximum BVH depth
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        int node = stack[--top];
+        num_bin_tests++;
+
+        real t_entry;
+        if (!ray_aabb(ray, bvh_min[node] - origin, bvh_max[node] - origin, t_hit, t_entry))
+            continue;
+
+        if (node < n - 1) {
+            stack[top++] = bvh_children[node].x;
+            stack[top++] = bvh_children[node].y;
+            continue;
+        }
+
+        shape.index = bvh_shape[node - (n - 1)];
+        if (id_rigid[shape.index] == UINT_MAX)
+            continue;
+        if (body_filter >= 0 && id_rigid[shape.index] != (uint)body_filter)
+            continue;
+        num_shape_tests++;
+        if (CheckShape(shape, start, end, info.normal, mindist2)) {
+            hit_shape = shape.index;
+            t_hit = Sqrt(mindist2) / length;
+        }
+    }
+
+    if (hit_shape < 0)
+        return false;
+
+    info.shapeID = hit_shape;           // Identifier of closest hit shape
+    info.dist = Sqrt(mindist2);         // Distance from ray origin
+    info.t = info.dist / length;        // Ray parameter at intersection with closest shape
+    info.point = start + info.t * ray;  // Intersection point
+
+    return true;
+}
+
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
 // fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
@@ -493,11 +612,219 @@ bool ChRayTest::CheckShape(const ConvexBase& shape,
         case ChCollisionShape::Type::TRIANGLE:
             return triangle_ray(shape.Triangles()[0], shape.Triangles()[1], shape.Triangles()[2], start, end, normal,
                                 mindist2);
+        case ChCollisionShape::Type::TRIANGLEMESH: {
+            // Check only the mesh triangles with AABBs intersected by the ray (expressed in the mesh frame)
+            real3 pos = shape.A();
+            quaternion rot = shape.R();
+            std::vector<int> triangles;
+            shape.Mesh()->FindRayOverlaps(TransformParentToLocal(pos, rot, start),
+                                          TransformParentToLocal(pos, rot, end), triangles);
+            bool hit = false;
+            real3 tri_normal;
+            for (auto t : triangles) {
+                const real3* tri = shape.Mesh()->GetTriangle(t);
+                if (triangle_ray(TransformLocalToParent(pos, rot, tri[0]), TransformLocalToParent(pos, rot, tri[1]),
+                                 TransformLocalToParent(pos, rot, tri[2]), start, end, tri_normal, mindist2)) {
+                    normal = tri_normal;
+                    hit = true;
+                }
+            }
+            return hit;
+        }
         default:
             //// TODO: fallback on generic ray-convex intersection test
             return false;
     }
 }
 
+// =============================================================================
+
+// Sphere sweep test. Candidate shapes are those with AABBs intersected by the sweep segment, with the AABBs inflated by
+// the sphere radius. These are found by traversing the broadphase BVH or, otherwise, the grid bins overlapped by the
+// swept AABB (each shape is considered only in the first common bin, see current_bin).
+bool ChRayTest::CheckSphere(const real3& start,
+                            const real3& end,
+                            real radius,
+                            const short2& family,
+                            int body_exclude,
+                            RayHitInfo& info) {
+    const std::vector<short2>& fam_rigid = cd_data->shape_data.fam_rigid;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    // Sweep start point relative to the grid origin and sweep direction
+    real3 origin = start - cd_data->global_origin;
+    real3 ray = end - start;
+    real3 inflate(radius);
+
+    ConvexShape shape(-1, &cd_data->shape_data);
+    real t_hit = 1;
+    int hit_shape = -1;
+
+    auto test_shape = [&](uint index) {
+        if (id_rigid[index] == UINT_MAX || (body_exclude >= 0 && id_rigid[index] == (uint)body_exclude))
+            return;
+        if (!collide(family, fam_rigid[index]))
+            return;
+        real t_entry;
+        if (!ray_aabb(ray, aabb_min[index] - inflate - origin, aabb_max[index] + inflate - origin, t_hit, t_entry))
+            return;
+        num_shape_tests++;
+        shape.index = index;
+        real t;
+        real3 point, normal;
+        if (SweepShape(shape, start, end, radius, t_hit, t, point, normal)) {
+            hit_shape = index;
+            t_hit = t;
+            info.point = point;
+            info.normal = normal;
+        }
+    };
+
+    if (cd_data->bvh_num_leaves > 0) {
+        const int n = cd_data->bvh_num_leaves;
+        const std::vector<uint>& bvh_shape = cd_data->bvh_shape;
+        const std::vector<vec2>& bvh_children = cd_data->bvh_children;
+        const std::vector<real3>& bvh_min = cd_data->bvh_min;
+        const std::vector<real3>& bvh_max = cd_data->bvh_max;
+
+        int stack[128];  // larger than the maximum BVH depth
+        int top = 0;
+        stack[top++] = 0;
+
+        while (top > 0) {
+            int node = stack[--top];
+            num_bin_tests++;
+
+            real t_entry;
+            if (!ray_aabb(ray, bvh_min[node] - inflate - origin, bvh_max[node] + inflate - origin, t_hit, t_entry))
+                continue;
+
+            if (node < n - 1) {
+                stack[top++] = bvh_children[node].x;
+                stack[top++] = bvh_children[node].y;
+                continue;
+            }
+
+            test_shape(bvh_shape[node - (n - 1)]);
+        }
+    } else if (cd_data->num_active_bins > 0) {
+        const vec3& bins_per_axis = cd_data->bins_per_axis;
+        const real3& inv_bin_size = cd_data->inv_bin_size;
+        const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+        const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+
+        // Range of bins overlapped by the swept AABB
+        real3 sweep_min = Min(start, end) - inflate - cd_data->global_origin;
+        real3 sweep_max = Max(start, end) + inflate - cd_data->global_origin;
+        vec3 gmin = Clamp(HashMin(sweep_min, inv_bin_size), vec3(0, 0, 0), bins_per_axis - vec3(1, 1, 1));
+        vec3 gmax = Clamp(HashMax(sweep_max, inv_bin_size), vec3(0, 0, 0), bins_per_axis - vec3(1, 1, 1));
+
+        for (int i = gmin.x; i <= gmax.x; i++) {
+            for (int j = gmin.y; j <= gmax.y; j++) {
+                for (int k = gmin.z; k <= gmax.z; k++) {
+                    num_bin_tests++;
+                    uint bin_index = Hash_Index(vec3(i, j, k), bins_per_axis);
+                    for (uint b = bin_start_index_ext[bin_index]; b < bin_start_index_ext[bin_index + 1]; b++) {
+                        uint index = bin_aabb_number[b];
+                        if (current_bin(aabb_min[index], aabb_max[index], sweep_min, sweep_max, inv_bin_size,
+                                        bins_per_axis, bin_index))
+                            test_shape(index);
+                    }
+                }
+            }
+        }
+    }
+
+    if (hit_shape < 0)
+        return false;
+
+    info.shapeID = hit_shape;         // Identifier of hit shape
+    info.t = t_hit;                   // Sweep parameter at time of impact
+    info.dist = t_hit * Length(ray);  // Distance travelled by the sphere center
+
+    return true;
+}
+
+// Time of impact of a moving sphere with a given shape, calculated by conservative advancement: at each iteration, the
+// sphere is advanced along the sweep by the current sphere-shape distance (a lower bound on the distance the sphere can
+// travel without touching the shape). The search stops when the sphere is within a small tolerance of the shape
+// (impact), when the shape is farther than the remaining sweep length (no impact), or after a maximum number of
+// iterations. The latter happens for grazing sweeps, where the sphere stays close to the shape without touching it or
+// touches it further along; an impact is then conservatively reported at the current sweep parameter.
+bool ChRayTest::SweepShape(const ConvexBase& shape,
+                           const real3& start,
+                           const real3& end,
+                           real radius,
+                           real t_max,
+                           real& t,
+                           real3& point,
+                           real3& normal) {
+    static const int max_iterations = 32;
+
+    // Process mesh shapes one triangle at a time (only triangles with AABBs overlapped by the swept AABB)
+    if (shape.Type() == ChCollisionShape::Type::TRIANGLEMESH) {
+        real3 pos = shape.A();
+        quaternion rot = shape.R();
+        real3 start_loc = TransformParentToLocal(pos, rot, start);
+        real3 end_loc = TransformParentToLocal(pos, rot, end);
+        std::vector<int> triangles;
+        shape.Mesh()->FindOverlaps(Min(start_loc, end_loc) - real3(radius), Max(start_loc, end_loc) + real3(radius),
+                                   triangles);
+        bool hit = false;
+        for (auto tri : triangles) {
+            const real3* vertices = shape.Mesh()->GetTriangle(tri);
+            ConvexShapeTriangle triangle;
+            triangle.tri[0] = TransformLocalToParent(pos, rot, vertices[0]);
+            triangle.tri[1] = TransformLocalToParent(pos, rot, vertices[1]);
+            triangle.tri[2] = TransformLocalToParent(pos, rot, vertices[2]);
+            if (SweepShape(triangle, start, end, radius, t_max, t, point, normal)) {
+                t_max = t;
+                hit = true;
+            }
+        }
+        return hit;
+    }
+
+    real3 sweep = end - start;
+    real length = Length(sweep);
+    real tolerance = 1e-3 * radius;
+    if (length == 0)
+        return false;
+
+    real s = 0;
+    real3 norm, ptA, ptB;
+    for (int it = 0; it < max_iterations; it++) {
+        // Distance between the shape and the sphere at the current sweep parameter (only if less than the remaining
+        // sweep length before t_max).
+        ConvexShapeSphere sphere(start + s * sweep, radius);
+        real depth, eff_radius;
+        int nC;
+        if (!ChNarrowphase::PRIMSCollision(&shape, &sphere, (t_max - s) * length + tolerance, &norm, &ptA, &ptB,
+                                           &depth, &eff_radius, nC))
+            return false;
+        if (nC == 0)
+            return false;
+
+        if (depth <= tolerance) {
+            t = s;
+            point = ptA;
+            normal = norm;
+            return true;
+        }
+
+        s += depth / length;
+        if (s >= t_max)
+            return false;
+    }
+
+    // No convergence: the sphere is still within the remaining sweep length of the shape
+    t = s;
+    point = ptA;
+    normal = norm;
+    return true;
+}
+
 }  // end namespace collision
 }  // end namespace chrono
@@ -43,19 +43,52 @@ class ChApi ChRayTest {
 
     /// Check for intersection of the given ray with all collision shapes in the system.
     /// Uses a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems",
-    /// 1986) to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
-    bool Check(const real3& start,  ///< ray start point
-               const real3& end,    ///< ray end point
-               RayHitInfo& info     ///< [output] test result info
+    /// 1986) to efficiently traverse the broadphase grid and analytical shape-ray intersection tests. If the broadphase
+    /// uses a BVH, the hierarchy is traversed instead.
+    /// The collision data is only read, so that concurrent tests can be performed with separate ChRayTest objects.
+    bool Check(const real3& start,     ///< ray start point
+               const real3& end,       ///< ray end point
+               RayHitInfo& info,       ///< [output] test result info
+               int body_filter = -1    ///< if non-negative, only test shapes of the body with this ID
     );
 
-    /// Return the number of bins visited by the DDA algorithm during the last ray test.
+    /// Check for intersection of the given ray with the specified range of collision shapes only.
+    /// Each shape in the range is tested directly, without traversal of the broadphase grid or BVH. This is more
+    /// efficient than Check() with a body filter when testing against the few shapes of a single body.
+    bool CheckShapes(const real3& start,  ///< ray start point
+                     const real3& end,    ///< ray end point
+                     int first_shape,     ///< index of first shape to test
+                     int num_shapes,      ///< number of shapes to test
+                     RayHitInfo& info     ///< [output] test result info
+    );
+
+    /// Check for the first contact of a sphere with given radius, moving from `start` to `end`, with the collision shapes
+    /// in the system (sphere sweep test). Shapes of the body with ID `body_exclude` and shapes which do not collide with
+    /// the collision family `family` (group and mask) are ignored.
+    /// The time of impact with each candidate shape is found by conservative advancement, using the PRIMS functions to
+    /// calculate the distance between the sphere and the shape (see ChNarrowphase::PRIMSCollision). Shape types which
+    /// are not supported by PRIMS for collision with a sphere are ignored. On output, `info.point` is the contact point
+    /// on the hit shape, `info.normal` is the contact normal (pointing towards the sphere), and `info.t` is the sweep
+    /// parameter at the time of impact.
+    bool CheckSphere(const real3& start,    ///< sphere center at start of sweep
+                     const real3& end,      ///< sphere center at end of sweep
+                     real radius,           ///< sphere radius
+                     const short2& family,  ///< collision family of the sphere
+                     int body_exclude,      ///< if non-negative, ignore shapes of the body with this ID
+                     RayHitInfo& info       ///< [output] test result info
+    );
+
+    /// Return the number of bins visited by the DDA algorithm (or of BVH nodes visited, if the broadphase uses a BVH)
+    /// during the last ray test.
     uint GetNumBinTests() const { return num_bin_tests; }
 
     /// Return the number of ray-shape checks required by the last ray test.
     uint GetNumShapeTests() const { return num_shape_tests; }
 
   private:
+    /// Ray intersection test using the broadphase BVH (see ChBroadphase::GridType::BVH).
+    bool CheckBVH(const real3& start, const real3& end, RayHitInfo& info, int body_filter);
+
     /// Dispatcher for analytic functions for ray intersection with primitive shapes.
     bool CheckShape(const ConvexBase& shape,  ///< candidate shape
                     const real3& start,       ///< ray start point
@@ -64,6 +97,17 @@ class ChApi ChRayTest {
                     real& mindist2            ///< [output] smallest squared distance to ray origin
     );
 
+    /// Sphere sweep test with a single shape, for sweep parameters smaller than `t_max`.
+    /// Return true if a contact was found, together with the sweep parameter, contact point, and contact normal.
+    bool SweepShape(const ConvexBase& shape,
+                    const real3& start,
+                    const real3& end,
+                    real radius,
+                    real t_max,
+                    real& t,
+                    real3& point,
+                    real3& normal);
+
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
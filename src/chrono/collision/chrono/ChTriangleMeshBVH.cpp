@@ -0,0 +1,162 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/collision/chrono/ChTriangleMeshBVH.h"
+#include "chrono/collision/chrono/ChCollisionUtils.h"
+
+namespace chrono {
+namespace collision {
+
+using namespace chrono::collision::ch_utils;
+
+// Traversal stack size. With median splits, the depth of the hierarchy is about log2 of the number of triangles.
+static const int stack_size = 64;
+
+ChTriangleMeshBVH::ChTriangleMeshBVH(const std::vector<real3>& vertices) {
+    int num_triangles = (int)vertices.size() / 3;
+
+    std::vector<real3> centers(num_triangles);
+    std::vector<int> order(num_triangles);
+    for (int i = 0; i < num_triangles; i++) {
+        centers[i] = (vertices[3 * i + 0] + vertices[3 * i + 1] + vertices[3 * i + 2]) / 3;
+        order[i] = i;
+    }
+
+    // Build the hierarchy (root is node 0), then store the triangle vertices in the order of the leaves
+    m_node.reserve(2 * num_triangles / max_leaf_size + 1);
+    Build(order, centers, 0, num_triangles);
+
+    m_vertices.resize(3 * num_triangles);
+    for (int i = 0; i < num_triangles; i++) {
+        m_vertices[3 * i + 0] = vertices[3 * order[i] + 0];
+        m_vertices[3 * i + 1] = vertices[3 * order[i] + 1];
+        m_vertices[3 * i + 2] = vertices[3 * order[i] + 2];
+    }
+
+    // Calculate the node AABBs. Children are always stored after their parent node.
+    int num_nodes = (int)m_node.size();
+    m_min.assign(num_nodes, real3(+C_REAL_MAX));
+    m_max.assign(num_nodes, real3(-C_REAL_MAX));
+    for (int node = num_nodes - 1; node >= 0; node--) {
+        const vec2& n = m_node[node];
+        if (n.x < 0) {
+            for (int v = 3 * (-n.x - 1); v < 3 * (-n.x - 1 + n.y); v++) {
+                m_min[node] = Min(m_min[node], m_vertices[v]);
+                m_max[node] = Max(m_max[node], m_vertices[v]);
+            }
+        } else {
+            m_min[node] = Min(m_min[n.x], m_min[n.y]);
+            m_max[node] = Max(m_max[n.x], m_max[n.y]);
+        }
+    }
+}
+
+int ChTriangleMeshBVH::Build(std::vector<int>& order, const std::vector<real3>& centers, int first, int last) {
+    int node = (int)m_node.size();
+    m_node.push_back(vec2(-(first + 1), last - first));
+
+    if (last - first <= max_leaf_size)
+        return node;
+
+    // Split at the median of the triangle centers along the longest axis of their AABB
+    real3 cmin(+C_REAL_MAX);
+    real3 cmax(-C_REAL_MAX);
+    for (int i = first; i < last; i++) {
+        cmin = Min(cmin, centers[order[i]]);
+        cmax = Max(cmax, centers[order[i]]);
+    }
+    real3 extent = cmax - cmin;
+    int axis = (extent.x > extent.y) ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+    int mid = (first + last) / 2;
+    std::nth_element(order.begin() + first, order.begin() + mid, order.begin() + last,
+                     [&centers, axis](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+
+    int left = Build(order, centers, first, mid);
+    int right = Build(order, centers, mid, last);
+    m_node[node] = vec2(left, right);
+    return node;
+}
+
+void ChTriangleMeshBVH::FindOverlaps(const real3& aabb_min,
+                                     const real3& aabb_max,
+                                     std::vector<int>& triangles) const {
+    int stack[stack_size];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        int node = stack[--top];
+        if (!overlap(aabb_min, aabb_max, m_min[node], m_max[node]))
+            continue;
+        const vec2& n = m_node[node];
+        if (n.x >= 0) {
+            stack[top++] = n.x;
+            stack[top++] = n.y;
+            continue;
+        }
+        for (int i = -n.x - 1; i < -n.x - 1 + n.y; i++) {
+            real3 tmin = Min(m_vertices[3 * i], Min(m_vertices[3 * i + 1], m_vertices[3 * i + 2]));
+            real3 tmax = Max(m_vertices[3 * i], Max(m_vertices[3 * i + 1], m_vertices[3 * i + 2]));
+            if (overlap(aabb_min, aabb_max, tmin, tmax))
+                triangles.push_back(i);
+        }
+    }
+}
+
+// Check if the segment start + t * ray, with t in [0,1], intersects the given AABB (slab test).
+static inline bool segment_aabb(const real3& start, const real3& ray, const real3& aabb_min, const real3& aabb_max) {
+    real t0 = 0;
+    real t1 = 1;
+    for (int i = 0; i < 3; i++) {
+        if (ray[i] == 0) {
+            if (start[i] < aabb_min[i] || start[i] > aabb_max[i])
+                return false;
+            continue;
+        }
+        real ta = (aabb_min[i] - start[i]) / ray[i];
+        real tb = (aabb_max[i] - start[i]) / ray[i];
+        t0 = Max(t0, Min(ta, tb));
+        t1 = Min(t1, Max(ta, tb));
+        if (t0 > t1)
+            return false;
+    }
+    return true;
+}
+
+void ChTriangleMeshBVH::FindRayOverlaps(const real3& start, const real3& end, std::vector<int>& triangles) const {
+    real3 ray = end - start;
+
+    int stack[stack_size];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        int node = stack[--top];
+        if (!segment_aabb(start, ray, m_min[node], m_max[node]))
+            continue;
+        const vec2& n = m_node[node];
+        if (n.x >= 0) {
+            stack[top++] = n.x;
+            stack[top++] = n.y;
+            continue;
+        }
+        for (int i = -n.x - 1; i < -n.x - 1 + n.y; i++)
+            triangles.push_back(i);
+    }
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -0,0 +1,75 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Bounding volume hierarchy for the triangles of a mesh collision shape
+//
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/multicore_math/ChMulticoreMath.h"
+
+namespace chrono {
+namespace collision {
+
+/// @addtogroup collision_mc
+/// @{
+
+/// Bounding volume hierarchy for the triangles of a mesh collision shape.
+/// The hierarchy is built once, in the frame of the mesh shape. The broadphase treats a mesh shape as a single shape,
+/// bounded by the AABB of the hierarchy root; the narrowphase descends the hierarchy to find the triangles which can
+/// collide with the other shape of a candidate pair.
+class ChApi ChTriangleMeshBVH {
+  public:
+    /// Construct the hierarchy for the given triangles (3 consecutive vertices per triangle).
+    /// Note that triangles are reordered.
+    ChTriangleMeshBVH(const std::vector<real3>& vertices);
+
+    /// Return the number of triangles in the mesh.
+    int GetNumTriangles() const { return (int)m_vertices.size() / 3; }
+
+    /// Return the 3 vertices of the specified triangle.
+    const real3* GetTriangle(int index) const { return &m_vertices[3 * index]; }
+
+    /// Return the minimum point of the mesh AABB.
+    const real3& GetMin() const { return m_min[0]; }
+
+    /// Return the maximum point of the mesh AABB.
+    const real3& GetMax() const { return m_max[0]; }
+
+    /// Append to the given list the indices of all triangles whose AABB overlaps the specified AABB.
+    void FindOverlaps(const real3& aabb_min, const real3& aabb_max, std::vector<int>& triangles) const;
+
+    /// Append to the given list the indices of all triangles whose AABB is intersected by the specified segment.
+    void FindRayOverlaps(const real3& start, const real3& end, std::vector<int>& triangles) const;
+
+  private:
+    /// Build the subtree for triangles in [first, last) and return the index of its root node.
+    int Build(std::vector<int>& order, const std::vector<real3>& centers, int first, int last);
+
+    static const int max_leaf_size = 4;
+
+    std::vector<real3> m_vertices;  ///< triangle vertices, in hierarchy order
+    std::vector<real3> m_min;       ///< node AABB minimum point
+    std::vector<real3> m_max;       ///< node AABB maximum point
+    std::vector<vec2> m_node;       ///< children (internal nodes) or -(first triangle + 1) and count (leaves)
+};
+
+/// @} collision_mc
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -102,6 +102,7 @@ class ChApi ChElementBase {
     /// Add the internal forces (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += forces * c
+    /// Note that ChMesh calls this function in parallel for elements that do not share nodes.
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {}
 
     /// Add the product of element mass M by a vector w (pasted at global nodes offsets) into
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
@@ -45,6 +46,10 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    m_color_elements = other.m_color_elements;
+    m_color_start = other.m_color_start;
+    m_color_dirty = other.m_color_dirty;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
@@ -67,6 +72,61 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    ColorElements();
+}
+
+void ChMesh::ColorElements() {
+    // Index the nodes of this mesh (elements may also refer to nodes not in this mesh)
+    std::unordered_map<ChNodeFEAbase*, int> node_index;
+    for (unsigned int i = 0; i < vnodes.size(); i++)
+        node_index.emplace(vnodes[i].get(), i);
+
+    // Greedy coloring: assign to each element the smallest color not already used by an element sharing one of its
+    // nodes. All nodes (including fixed ones) are considered, so that the coloring does not depend on node states.
+    int nelements = (int)velements.size();
+    std::vector<std::vector<int>> node_colors(vnodes.size());
+    std::vector<int> elem_color(nelements);
+    std::vector<int> forbidden;  // forbidden[c] == ie if color c is used by a neighbor of element ie
+    std::vector<int> elem_nodes;
+    for (int ie = 0; ie < nelements; ie++) {
+        elem_nodes.clear();
+        for (int in = 0; in < velements[ie]->GetNnodes(); in++) {
+            auto result = node_index.emplace(velements[ie]->GetNodeN(in).get(), (int)node_colors.size());
+            if (result.second)
+                node_colors.emplace_back();
+            elem_nodes.push_back(result.first->second);
+        }
+
+        for (auto node : elem_nodes) {
+            for (auto c : node_colors[node])
+                forbidden[c] = ie;
+        }
+
+        int color = 0;
+        while (color < (int)forbidden.size() && forbidden[color] == ie)
+            color++;
+        if (color == (int)forbidden.size())
+            forbidden.push_back(-1);
+        elem_color[ie] = color;
+
+        for (auto node : elem_nodes)
+            node_colors[node].push_back(color);
+    }
+
+    // Sort elements by color (counting sort, preserving the original order within each color)
+    int ncolors = (int)forbidden.size();
+    m_color_start.assign(ncolors + 1, 0);
+    for (int ie = 0; ie < nelements; ie++)
+        m_color_start[elem_color[ie] + 1]++;
+    for (int c = 0; c < ncolors; c++)
+        m_color_start[c + 1] += m_color_start[c];
+    m_color_elements.resize(nelements);
+    std::vector<int> pos(m_color_start.begin(), m_color_start.end() - 1);
+    for (int ie = 0; ie < nelements; ie++)
+        m_color_elements[pos[elem_color[ie]]++] = ie;
+
+    m_color_dirty = false;
 }
 
 void ChMesh::Relax() {
@@ -96,6 +156,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    m_color_dirty = true;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -107,6 +168,9 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    m_color_elements.clear();
+    m_color_start.clear();
+    m_color_dirty = true;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -118,6 +182,9 @@ void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    m_color_elements.clear();
+    m_color_start.clear();
+    m_color_dirty = true;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -155,6 +222,10 @@ void ChMesh::Setup() {
             n_dofs_w += vnodes[i]->GetNdofW_active();
         }
     }
+
+    // Recolor the elements if they changed since the last coloring (e.g., elements added after initialization)
+    if (m_color_dirty)
+        ColorElements();
 }
 
 // Updates all time-dependant variables, if any...
@@ -296,22 +367,32 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     int nthreads = GetSystem()->nthreads_chrono;
 
+    // the element coloring is normally computed at setup; make sure it is up to date
+    if (m_color_dirty)
+        ColorElements();
+    int ncolors = GetNumElementColors();
+
     // elements internal forces
     timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+    //***PARALLEL FOR***, one color at a time: elements of the same color do not share nodes, hence they write to
+    // disjoint entries of R and no omp atomic is needed
+    for (int ic = 0; ic < ncolors; ic++) {
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+        for (int k = m_color_start[ic]; k < m_color_start[ic + 1]; k++) {
+            velements[m_color_elements[k]]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+        //***PARALLEL FOR***, one color at a time (see above)
+        for (int ic = 0; ic < ncolors; ic++) {
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
+            for (int k = m_color_start[ic]; k < m_color_start[ic + 1]; k++) {
+                velements[m_color_elements[k]]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
+            }
         }
     }
 
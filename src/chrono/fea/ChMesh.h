@@ -52,6 +52,10 @@ class ChApi ChMesh : public ChIndexedNodes {
     bool automatic_gravity_load;
     int num_points_gravity;
 
+    std::vector<int> m_color_elements;  ///< element indices, sorted by color (see ColorElements)
+    std::vector<int> m_color_start;     ///< start of each color in m_color_elements (size: number of colors + 1)
+    bool m_color_dirty;                 ///< elements were added or removed since the last coloring
+
     ChTimer timer_internal_forces;
     ChTimer timer_KRMload;
     int ncalls_internal_forces;
@@ -63,6 +67,7 @@ class ChApi ChMesh : public ChIndexedNodes {
           n_dofs_w(0),
           automatic_gravity_load(true),
           num_points_gravity(1),
+          m_color_dirty(true),
           ncalls_internal_forces(0),
           ncalls_KRMload(0) {}
     ChMesh(const ChMesh& other);
@@ -97,6 +102,9 @@ class ChApi ChMesh : public ChIndexedNodes {
     virtual int GetDOF() override { return n_dofs; }
     virtual int GetDOF_w() override { return n_dofs_w; }
 
+    /// Get the number of colors in the element coloring used for the parallel evaluation of nodal forces.
+    int GetNumElementColors() const { return m_color_start.empty() ? 0 : (int)m_color_start.size() - 1; }
+
     /// Override default in ChPhysicsItem.
     virtual bool GetCollide() const override { return true; }
 
@@ -285,6 +293,10 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the elements in colors, such that no two elements with the same color share a node.
+    /// Elements of the same color can then load their nodal forces in parallel, without race conditions.
+    void ColorElements();
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
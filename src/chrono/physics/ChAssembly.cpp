@@ -22,6 +22,9 @@
 
 namespace chrono {
 
+// Lists with fewer items than this are processed serially (not worth the cost of a parallel region).
+static const int min_parallel_items = 64;
+
 using namespace fea;
 using namespace collision;
 using namespace geometry;
@@ -634,23 +637,57 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Update all physical items (bodies, links, meshes, etc), including their auxiliary variables.
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
+//
+// Bodies, shafts, and links are updated in parallel if enough of them and if enabled (see
+// ChSystem::EnableParallelAssemblyUpdate).
+// Each item only modifies its own data, so that results do not depend on the number of threads. Visualization assets
+// (which may be shared between items) are always updated serially, in a separate pass.
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
-        bodylist[ip]->Update(ChTime, update_assets);
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+    //// NOTE: do not switch these to range for loops (OMP for)
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        bodylist[ip]->Update(ChTime, false);
     }
-    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
-        shaftlist[ip]->Update(ChTime, update_assets);
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        shaftlist[ip]->Update(ChTime, false);
     }
     for (int ip = 0; ip < (int)otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->Update(ChTime, update_assets);
     }
-    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
-        linklist[ip]->Update(ChTime, update_assets);
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        linklist[ip]->Update(ChTime, false);
     }
     for (int ip = 0; ip < (int)meshlist.size(); ++ip) {
         meshlist[ip]->Update(ChTime, update_assets);
     }
+
+    if (update_assets)
+        UpdateAssets();
+}
+
+void ChAssembly::UpdateAssets() {
+    for (auto& body : bodylist) {
+        body->ChPhysicsItem::Update(body->GetChTime(), true);
+    }
+    for (auto& shaft : shaftlist) {
+        shaft->ChPhysicsItem::Update(shaft->GetChTime(), true);
+    }
+    for (auto& link : linklist) {
+        link->ChPhysicsItem::Update(link->GetChTime(), true);
+    }
+}
+
+int ChAssembly::GetNumThreads() const {
+    if (!system || !system->IsParallelAssemblyUpdateEnabled())
+        return 1;
+    return system->GetNumThreadsChrono();
 }
 
 void ChAssembly::SetNoSpeedNoAcceleration() {
@@ -678,18 +715,32 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
                                 double& T) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+    // Note: the time returned by each item is discarded (T is set below), so that threads do not write to T.
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
+        double T_item;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
+        double T_item;
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T_item);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
+        double T_item;
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T_item);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
@@ -714,50 +765,74 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // 2. Order below is *important*
     //    - in particular, bodies and meshes must be processed *before* links, so that links can use
     //      up-to-date body and node information
+    // 3. Bodies, shafts, and links are processed in parallel (each list after the previous one), with the update of
+    //    their visualization assets deferred to a final serial pass (see Update()).
 
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
-            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
+            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, false);
         else
-            body->Update(T, full_update);
+            body->Update(T, false);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
-            shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T, full_update);
+            shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T, false);
         else
-            shaft->Update(T, full_update);
+            shaft->Update(T, false);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
-            link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
+            link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, false);
         else
-            link->Update(T, full_update);
+            link->Update(T, false);
     }
     for (auto& item : otherphysicslist) {
         if (item->IsActive())
             item->IntStateScatter(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v, T, full_update);
     }
+    if (full_update)
+        UpdateAssets();
     SetChTime(T);
 }
 
 void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateGatherAcceleration(displ_a + body->GetOffset_w(), a);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateGatherAcceleration(displ_a + shaft->GetOffset_w(), a);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateGatherAcceleration(displ_a + link->GetOffset_w(), a);
     }
@@ -773,16 +848,26 @@ void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDel
 // From state derivative (acceleration) to system, sometimes might be needed
 void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateScatterAcceleration(displ_a + body->GetOffset_w(), a);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateScatterAcceleration(displ_a + shaft->GetOffset_w(), a);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateScatterAcceleration(displ_a + link->GetOffset_w(), a);
     }
@@ -798,16 +883,26 @@ void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChS
 // From system to reaction forces (last computed) - some timestepper might need this
 void ChAssembly::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateGatherReactions(displ_L + body->GetOffset_L(), L);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateGatherReactions(displ_L + shaft->GetOffset_L(), L);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateGatherReactions(displ_L + link->GetOffset_L(), L);
     }
@@ -823,16 +918,26 @@ void ChAssembly::IntStateGatherReactions(const unsigned int off_L, ChVectorDynam
 // From reaction forces to system, ex. store last computed reactions in ChLinkBase objects for plotting etc.
 void ChAssembly::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateScatterReactions(displ_L + body->GetOffset_L(), L);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateScatterReactions(displ_L + shaft->GetOffset_L(), L);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateScatterReactions(displ_L + link->GetOffset_L(), L);
     }
@@ -852,18 +957,28 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
                                    const ChStateDelta& Dv) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -885,18 +1000,28 @@ void ChAssembly::IntStateGetIncrement(const unsigned int off_x,
                                    ChStateDelta& Dv) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateGetIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateGetIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateGetIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -916,12 +1041,19 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
@@ -944,12 +1076,19 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
                                     const double c               ///< a scaling factor
 ) {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c);
     }
@@ -1001,6 +1140,8 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
                                      double recovery_clamp      ///< value for min/max clamping of c*C
 ) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreads();
+    int num_links = (int)linklist.size();
 
     for (auto& body : bodylist) {
         if (body->IsActive())
@@ -1010,7 +1151,9 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
         if (shaft->IsActive())
             shaft->IntLoadConstraint_C(displ_L + shaft->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntLoadConstraint_C(displ_L + link->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
@@ -1028,6 +1171,8 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
                                       const double c             ///< a scaling factor
 ) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreads();
+    int num_links = (int)linklist.size();
 
     for (auto& body : bodylist) {
         if (body->IsActive())
@@ -1037,7 +1182,9 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
         if (shaft->IsActive())
             shaft->IntLoadConstraint_Ct(displ_L + shaft->GetOffset_L(), Qc, c);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntLoadConstraint_Ct(displ_L + link->GetOffset_L(), Qc, c);
     }
@@ -1058,18 +1205,28 @@ void ChAssembly::IntToDescriptor(const unsigned int off_v,
                                  const ChVectorDynamic<>& Qc) {
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntToDescriptor(displ_v + body->GetOffset_w(), v, R, displ_L + body->GetOffset_L(), L, Qc);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntToDescriptor(displ_v + shaft->GetOffset_w(), v, R, displ_L + shaft->GetOffset_L(), L, Qc);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntToDescriptor(displ_v + link->GetOffset_w(), v, R, displ_L + link->GetOffset_L(), L, Qc);
     }
@@ -1090,18 +1247,28 @@ void ChAssembly::IntFromDescriptor(const unsigned int off_v,
                                    ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
-
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntFromDescriptor(displ_v + body->GetOffset_w(), v, displ_L + body->GetOffset_L(), L);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntFromDescriptor(displ_v + shaft->GetOffset_w(), v, displ_L + shaft->GetOffset_L(), L);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntFromDescriptor(displ_v + link->GetOffset_w(), v, displ_L + link->GetOffset_L(), L);
     }
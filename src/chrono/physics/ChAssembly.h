@@ -207,6 +207,8 @@ class ChApi ChAssembly : public ChPhysicsItem {
 
     /// Updates all the auxiliary data and children of
     /// bodies, forces, links, given their current state.
+    /// Bodies, shafts, and links are processed in parallel if enabled in the owning system (see
+    /// ChSystem::EnableParallelAssemblyUpdate). Results do not depend on the number of threads.
     virtual void Update(bool update_assets = true) override;
 
     /// Set zero speed (and zero accelerations) in state, without changing the position.
@@ -321,6 +323,12 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Update the visualization assets of all bodies, shafts, and links (serially, as assets may be shared).
+    void UpdateAssets();
+
+    /// Return the number of threads for the parallel loops over the assembly items (1 if not enabled).
+    int GetNumThreads() const;
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
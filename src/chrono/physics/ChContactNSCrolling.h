@@ -101,7 +101,13 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
         this->objB->ComputeJacobianForRollingContactPart(this->p2, this->contact_plane, Rx.Get_tuple_b(),
                                                          Ru.Get_tuple_b(), Rv.Get_tuple_b(), true);
 
-        this->react_torque = VNULL;
+        if (this->reactions_cache) {
+            react_torque.x() = this->reactions_cache[3];
+            react_torque.y() = this->reactions_cache[4];
+            react_torque.z() = this->reactions_cache[5];
+        } else {
+            react_torque = VNULL;
+        }
     }
 
     /// Get the contact force, if computed, in contact coordinate system
@@ -140,6 +146,12 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
         react_torque.x() = L(off_L + 3);
         react_torque.y() = L(off_L + 4);
         react_torque.z() = L(off_L + 5);
+
+        if (this->reactions_cache) {
+            this->reactions_cache[3] = (float)L(off_L + 3);
+            this->reactions_cache[4] = (float)L(off_L + 4);
+            this->reactions_cache[5] = (float)L(off_L + 5);
+        }
     }
 
     virtual void ContIntLoadResidual_CqL(const unsigned int off_L,
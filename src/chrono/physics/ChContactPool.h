@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Pooled storage of contact objects of a given type, used by the contact
+// containers in place of linked lists of individually allocated contacts.
+//
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cassert>
+#include <iterator>
+#include <new>
+#include <vector>
+
+#include "chrono/collision/ChCollisionInfo.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+class ChContactContainer;
+
+/// Pool of contact objects of type Tcont, stored in contiguous chunks of 2^chunk_bits objects.
+/// Contacts are constructed in place the first time a slot is used and are then re-initialized (through their
+/// Reset() function) when the slot is reused, so that, after a transient, no allocation happens from step to step.
+/// Chunks are never reallocated, hence pointers to contacts (and to the constraints they contain) stay valid for the
+/// whole lifetime of the pool. Iteration is over the active contacts only, in insertion order, and dereferencing an
+/// iterator returns a pointer to the contact (same as for the std::list<Tcont*> formerly used by the containers).
+template <class Tcont, int chunk_bits = 7>
+class ChContactPool {
+  public:
+    /// Forward iterator over the active contacts in the pool.
+    class iterator {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Tcont* value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Tcont* const* pointer;
+        typedef Tcont* reference;
+
+        iterator(const ChContactPool* pool, int index) : m_pool(pool), m_index(index) {}
+
+        Tcont* operator*() const { return m_pool->at(m_index); }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++m_index;
+            return tmp;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactPool* m_pool;
+        int m_index;
+    };
+
+    ChContactPool() : n_active(0), n_constructed(0) {}
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+    ~ChContactPool() { clear(); }
+
+    /// Return the number of active contacts.
+    int size() const { return n_active; }
+
+    /// Return true if there are no active contacts.
+    bool empty() const { return n_active == 0; }
+
+    /// Return the number of contact objects currently constructed (active or kept for reuse).
+    int capacity() const { return n_constructed; }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, n_active); }
+
+    /// Access the i-th contact in the pool.
+    Tcont* at(int i) const {
+        assert(i >= 0 && i < n_constructed);
+        return m_chunks[i >> chunk_bits] + (i & chunk_mask);
+    }
+
+    /// Mark all contacts as inactive, without destroying them.
+    /// Subsequent insertions reuse the existing contact objects, in order.
+    void rewind() { n_active = 0; }
+
+    /// Activate a new contact, reusing a previously constructed object if available.
+    /// Any additional arguments are passed to the contact constructor and to its Reset() function.
+    template <class Ta, class Tb, class Tmat, class... Targs>
+    Tcont* insert(ChContactContainer* container,
+                  Ta* objA,
+                  Tb* objB,
+                  const collision::ChCollisionInfo& cinfo,
+                  const Tmat& cmat,
+                  Targs... args) {
+        Tcont* contact;
+        if (n_active < n_constructed) {
+            // reuse old contact
+            contact = at(n_active);
+            contact->Reset(objA, objB, cinfo, cmat, args...);
+        } else {
+            // construct new contact in the first free slot, allocating a new chunk if needed
+            if ((n_constructed >> chunk_bits) == (int)m_chunks.size())
+                m_chunks.push_back(m_allocator.allocate(chunk_size));
+            contact = m_chunks[n_constructed >> chunk_bits] + (n_constructed & chunk_mask);
+            ::new (static_cast<void*>(contact)) Tcont(container, objA, objB, cinfo, cmat, args...);
+            n_constructed++;
+        }
+        n_active++;
+        return contact;
+    }
+
+    /// Destroy all contact objects and release the pool memory.
+    void clear() {
+        for (int i = 0; i < n_constructed; i++)
+            at(i)->~Tcont();
+        for (auto chunk : m_chunks)
+            m_allocator.deallocate(chunk, chunk_size);
+        m_chunks.clear();
+        n_active = 0;
+        n_constructed = 0;
+    }
+
+  private:
+    static const int chunk_size = 1 << chunk_bits;
+    static const int chunk_mask = chunk_size - 1;
+
+    std::vector<Tcont*> m_chunks;                 ///< contiguous blocks of chunk_size contacts each
+    Eigen::aligned_allocator<Tcont> m_allocator;  ///< contacts may contain fixed-size Eigen members
+    int n_active;                                 ///< number of contacts in use
+    int n_constructed;                            ///< number of slots holding a constructed contact
+};
+
+}  // end namespace chrono
+
+#endif
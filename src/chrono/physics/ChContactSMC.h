@@ -55,6 +55,56 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
         double mass1,                       ///< mass of obj1
         double mass2                        ///< mass of obj2
         ) const override {
+        return ComputeForce(sys, normal_dir, vel1, vel2, mat, delta, eff_radius, mass1, mass2, nullptr);
+    }
+
+    /// Default SMC force calculation algorithm for a contact with history.
+    /// If the MultiStep tangential displacement model is used, the tangential elastic force is calculated from the
+    /// accumulated tangential displacement (projected onto the current contact plane), which is then limited so that
+    /// the tangential force does not exceed the Coulomb limit. Otherwise, this is identical to CalculateForce.
+    virtual ChVector<> CalculateForceWithHistory(
+        const ChSystemSMC& sys,             ///< containing system
+        const ChVector<>& normal_dir,       ///< normal contact direction (expressed in global frame)
+        const ChVector<>& p1,               ///< most penetrated point on obj1 (expressed in global frame)
+        const ChVector<>& p2,               ///< most penetrated point on obj2 (expressed in global frame)
+        const ChVector<>& vel1,             ///< velocity of contact point on obj1 (expressed in global frame)
+        const ChVector<>& vel2,             ///< velocity of contact point on obj2 (expressed in global frame)
+        const ChMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        double delta,                       ///< overlap in normal direction
+        double eff_radius,                  ///< effective radius of curvature at contact
+        double mass1,                       ///< mass of obj1
+        double mass2,                       ///< mass of obj2
+        ChVector<>& tangential_displ        ///< [in/out] accumulated tangential displacement
+        ) const override {
+        return ComputeForce(sys, normal_dir, vel1, vel2, mat, delta, eff_radius, mass1, mass2, &tangential_displ);
+    }
+
+  private:
+    /// Magnitude of the adhesion force (to be subtracted from the normal contact force).
+    static double AdhesionForce(ChSystemSMC::AdhesionForceModel adhesion_model,
+                                const ChMaterialCompositeSMC& mat,
+                                double eff_radius) {
+        switch (adhesion_model) {
+            case ChSystemSMC::AdhesionForceModel::Perko:
+                // Currently not implemented.  Fall through to Constant.
+            case ChSystemSMC::AdhesionForceModel::Constant:
+                return mat.adhesion_eff;
+            case ChSystemSMC::AdhesionForceModel::DMT:
+                return mat.adhesionMultDMT_eff * sqrt(eff_radius);
+        }
+        return 0;
+    }
+
+    ChVector<> ComputeForce(const ChSystemSMC& sys,
+                            const ChVector<>& normal_dir,
+                            const ChVector<>& vel1,
+                            const ChVector<>& vel2,
+                            const ChMaterialCompositeSMC& mat,
+                            double delta,
+                            double eff_radius,
+                            double mass1,
+                            double mass2,
+                            ChVector<>* tangential_displ) const {
         // Set contact force to zero if no penetration.
         if (delta <= 0) {
             return ChVector<>(0, 0, 0);
@@ -154,16 +204,7 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
                     if (forceN < 0)
                         forceN = 0;
                     double forceT = mat.mu_eff * std::tanh(5.0 * relvel_t_mag) * forceN;
-                    switch (adhesion_model) {
-                        case ChSystemSMC::AdhesionForceModel::Perko:
-                            // Currently not implemented.  Fall through to Constant.
-                        case ChSystemSMC::AdhesionForceModel::Constant:
-                            forceN -= mat.adhesion_eff;
-                            break;
-                        case ChSystemSMC::AdhesionForceModel::DMT:
-                            forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
-                            break;
-                    }
+                    forceN -= AdhesionForce(adhesion_model, mat, eff_radius);
                     ChVector<> force = forceN * normal_dir;
                     if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
                         force -= (forceT / relvel_t_mag) * relvel_t;
@@ -172,14 +213,46 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
                 }
         }
 
+        // Contact with history: the tangential force has an elastic part depending on the tangential displacement
+        // accumulated since contact initiation and a viscous part depending on the current relative velocity.
+        if (tdispl_model == ChSystemSMC::MultiStep && tangential_displ) {
+            // Increment the tangential displacement and project it onto the current contact plane
+            ChVector<>& displ_t = *tangential_displ;
+            displ_t += relvel_t * dT;
+            displ_t -= displ_t.Dot(normal_dir) * normal_dir;
+
+            double forceN = kn * delta - gn * relvel_n_mag;
+            ChVector<> forceT_damp = gt * relvel_t;
+            ChVector<> forceT = kt * displ_t + forceT_damp;
+
+            // No contact force if the two shapes are moving away from each other too fast
+            if (forceN < 0) {
+                forceN = 0;
+                forceT = VNULL;
+            }
+
+            // Include adhesion force
+            forceN -= AdhesionForce(adhesion_model, mat, eff_radius);
+
+            // Coulomb law. If sliding, limit the stored displacement to the value consistent with the sliding force,
+            // so that the tangential force is correct if it subsequently drops below the Coulomb limit.
+            double forceT_mag = forceT.Length();
+            double forceT_slide = mat.mu_eff * std::abs(forceN);
+            if (forceT_mag > forceT_slide) {
+                forceT *= forceT_slide / forceT_mag;
+                if (kt > eps)
+                    displ_t = (forceT - forceT_damp) / kt;
+            }
+
+            return forceN * normal_dir - forceT;
+        }
+
         // Tangential displacement (magnitude)
         double delta_t = 0;
         switch (tdispl_model) {
             case ChSystemSMC::OneStep:
-                delta_t = relvel_t_mag * dT;
-                break;
             case ChSystemSMC::MultiStep:
-                //// TODO: implement proper MultiStep mode
+                // contacts without history use only the current relative tangential velocity
                 delta_t = relvel_t_mag * dT;
                 break;
             default:
@@ -198,16 +271,7 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
         }
 
         // Include adhesion force
-        switch (adhesion_model) {
-            case ChSystemSMC::AdhesionForceModel::Perko:
-                // Currently not implemented.  Fall through to Constant.
-            case ChSystemSMC::AdhesionForceModel::Constant:
-                forceN -= mat.adhesion_eff;
-                break;
-            case ChSystemSMC::AdhesionForceModel::DMT:
-                forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
-                break;
-        }
+        forceN -= AdhesionForce(adhesion_model, mat, eff_radius);
 
         // Coulomb law
         forceT = std::min<double>(forceT, mat.mu_eff * std::abs(forceN));
@@ -238,18 +302,21 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
 
     ChVector<> m_force;        ///< contact force on objB
     ChContactJacobian* m_Jac;  ///< contact Jacobian data
+    bool m_history;            ///< true if the contact has tangential displacement history
+    ChVector<> m_tdispl;       ///< tangential displacement at the beginning of the step (if m_history)
 
   public:
-    ChContactSMC() : m_Jac(NULL) {}
+    ChContactSMC() : m_Jac(NULL), m_history(false) {}
 
     ChContactSMC(ChContactContainer* mcontainer,           ///< contact container
                  Ta* mobjA,                                ///< collidable object A
                  Tb* mobjB,                                ///< collidable object B
                  const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
-                 const ChMaterialCompositeSMC& mat         ///< composite material
+                 const ChMaterialCompositeSMC& mat,        ///< composite material
+                 ChVector<>* tdispl = nullptr              ///< tangential displacement history (may be null)
                  )
-        : ChContactTuple<Ta, Tb>(mcontainer, mobjA, mobjB, cinfo), m_Jac(NULL) {
-        Reset(mobjA, mobjB, cinfo, mat);
+        : ChContactTuple<Ta, Tb>(mcontainer, mobjA, mobjB, cinfo), m_Jac(NULL), m_history(false) {
+        Reset(mobjA, mobjB, cinfo, mat, tdispl);
     }
 
     ~ChContactSMC() { delete m_Jac; }
@@ -269,10 +336,12 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     const ChMatrixDynamic<double>* GetJacobianR() const { return m_Jac ? &(m_Jac->m_R) : NULL; }
 
     /// Reinitialize this contact for reuse.
+    /// If provided, the tangential displacement history is updated during the force calculation.
     void Reset(Ta* mobjA,                                ///< collidable object A
                Tb* mobjB,                                ///< collidable object B
                const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
-               const ChMaterialCompositeSMC& mat         ///< composite material
+               const ChMaterialCompositeSMC& mat,        ///< composite material
+               ChVector<>* tdispl = nullptr              ///< tangential displacement history (may be null)
     ) {
         // Reset geometric information
         this->Reset_cinfo(mobjA, mobjB, cinfo);
@@ -280,12 +349,18 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        // Cache the tangential displacement before its update, for use in the Jacobian calculation.
+        m_history = (tdispl != nullptr);
+        if (m_history)
+            m_tdispl = *tdispl;
+
         // Calculate contact force.
         m_force = CalculateForce(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 mat,                                         // composite material for contact pair
+                                 tdispl                                       // tangential displacement history
         );
 
         // Set up and compute Jacobian matrices.
@@ -296,12 +371,14 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     }
 
     /// Calculate contact force, expressed in absolute coordinates.
+    /// If a tangential displacement history is provided, it is updated by the SMC force algorithm.
     ChVector<> CalculateForce(
-        double delta,                      ///< overlap in normal direction
-        const ChVector<>& normal_dir,      ///< normal contact direction (expressed in global frame)
-        const ChVector<>& vel1,            ///< velocity of contact point on objA (expressed in global frame)
-        const ChVector<>& vel2,            ///< velocity of contact point on objB (expressed in global frame)
-        const ChMaterialCompositeSMC& mat  ///< composite material for contact pair
+        double delta,                       ///< overlap in normal direction
+        const ChVector<>& normal_dir,       ///< normal contact direction (expressed in global frame)
+        const ChVector<>& vel1,             ///< velocity of contact point on objA (expressed in global frame)
+        const ChVector<>& vel2,             ///< velocity of contact point on objB (expressed in global frame)
+        const ChMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        ChVector<>* tdispl = nullptr        ///< tangential displacement history (may be null)
     ) {
         // Set contact force to zero if no penetration.
         if (delta <= 0) {
@@ -310,6 +387,17 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
 
         // Use current SMC algorithm to calculate the force
         ChSystemSMC* sys = static_cast<ChSystemSMC*>(this->container->GetSystem());
+        if (tdispl) {
+            return sys->GetContactForceAlgorithm().CalculateForceWithHistory(*sys,                              //
+                                                                             normal_dir, this->p1, this->p2,    //
+                                                                             vel1, vel2,                        //
+                                                                             mat,                               //
+                                                                             delta, this->eff_radius,           //
+                                                                             this->objA->GetContactableMass(),  //
+                                                                             this->objB->GetContactableMass(),  //
+                                                                             *tdispl                            //
+            );
+        }
         return sys->GetContactForceAlgorithm().CalculateForce(*sys,                                        //
                                                               normal_dir, this->p1, this->p2, vel1, vel2,  //
                                                               mat,                                         //
@@ -524,7 +612,9 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChVector<> vel2 = this->objB->GetContactPointSpeed(p2_loc, stateB_x, stateB_w);
 
         // Compute the contact force.
-        ChVector<> force = CalculateForce(delta, normal_dir, vel1, vel2, mat);
+        // Work on a copy of the tangential displacement history, so that perturbed states do not alter it.
+        ChVector<> tdispl = m_tdispl;
+        ChVector<> force = CalculateForce(delta, normal_dir, vel1, vel2, mat, m_history ? &tdispl : nullptr);
 
         // Compute and load the generalized contact forces.
         this->objA->ContactForceLoadQ(-force, p1_abs, stateA_x, Q, 0);
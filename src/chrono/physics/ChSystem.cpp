@@ -26,6 +26,7 @@
 #include "chrono/solver/ChSolverPJacobi.h"
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
 #include "chrono/solver/ChSolverPSSOR.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
@@ -36,6 +37,13 @@ using namespace chrono::collision;
 
 namespace chrono {
 
+// Force an implicit integrator which reuses the Newton matrix across steps to update it at the next step.
+// Called whenever the solver may have been set up for a different problem (e.g., assembly or static analysis).
+static void ForceJacobianUpdate(std::shared_ptr<ChTimestepper> timestepper) {
+    if (auto implicit_stepper = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(timestepper))
+        implicit_stepper->ForceJacobianUpdate();
+}
+
 // -----------------------------------------------------------------------------
 // CLASS FOR PHYSICAL SYSTEM
 // -----------------------------------------------------------------------------
@@ -71,6 +79,7 @@ ChSystem::ChSystem()
       nthreads_chrono(ChOMP::GetNumProcs()),
       nthreads_eigen(1),
       nthreads_collision(1),
+      parallel_assembly_update(false),
       last_err(false),
       applied_forces_current(false) {
     assembly.system = this;
@@ -111,6 +120,7 @@ ChSystem::ChSystem(const ChSystem& other) {
     nthreads_chrono = other.nthreads_chrono;
     nthreads_eigen = other.nthreads_eigen;
     nthreads_collision = other.nthreads_collision;
+    parallel_assembly_update = other.parallel_assembly_update;
     is_initialized = false;
     is_updated = false;
     applied_forces_current = false;
@@ -160,6 +170,16 @@ void ChSystem::AddBody(std::shared_ptr<ChBody> body) {
     assembly.AddBody(body);
 }
 
+void ChSystem::RemoveBody(std::shared_ptr<ChBody> body) {
+    const auto& bodies = Get_bodylist();
+    size_t index = std::find(bodies.begin(), bodies.end(), body) - bodies.begin();
+    assembly.RemoveBody(body);
+
+    // Body IDs are indices in the body list; renumber the bodies following the removed one
+    for (size_t i = index; i < bodies.size(); i++)
+        bodies[i]->SetId(static_cast<int>(i));
+}
+
 void ChSystem::AddShaft(std::shared_ptr<ChShaft> shaft) {
     assembly.AddShaft(shaft);
 }
@@ -269,6 +289,12 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::PSSOR:
             solver = chrono_types::make_shared<ChSolverPSSOR>();
             break;
+        case ChSolver::Type::PSOR_COLORED: {
+            auto psor = chrono_types::make_shared<ChSolverPSORcolored>();
+            psor->SetNumThreads(nthreads_chrono);
+            solver = psor;
+            break;
+        }
         case ChSolver::Type::PJACOBI:
             solver = chrono_types::make_shared<ChSolverPJacobi>();
             break;
@@ -338,6 +364,7 @@ void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescri
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    ForceJacobianUpdate(timestepper);
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystemType type) {
@@ -393,6 +420,11 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
     nthreads_eigen = (num_threads_eigen <= 0) ? num_threads_chrono : num_threads_eigen;
 
     collision_system->SetNumThreads(nthreads_collision);
+
+    if (auto psor = std::dynamic_pointer_cast<ChSolverPSORcolored>(solver))
+        psor->SetNumThreads(nthreads_chrono);
+    else if (auto direct = std::dynamic_pointer_cast<ChDirectSolverLS>(solver))
+        direct->SetNumThreads(nthreads_chrono);
 }
 
 // -----------------------------------------------------------------------------
@@ -1307,6 +1339,9 @@ double ChSystem::ComputeCollisions() {
         }
     }
 
+    // Add speculative contacts for bodies with continuous collision detection enabled.
+    ComputeSweptContacts();
+
     // Invoke the custom collision callbacks (if any). These can potentially add
     // additional contacts to the contact container.
     for (size_t ic = 0; ic < collision_callbacks.size(); ic++)
@@ -1320,6 +1355,59 @@ double ChSystem::ComputeCollisions() {
     return mretC;
 }
 
+void ChSystem::ComputeSweptContacts() {
+    const auto& bodylist = assembly.Get_bodylist();
+    int num_bodies = (int)bodylist.size();
+
+    std::vector<collision::ChCollisionInfo> swept_contacts(num_bodies);
+    std::vector<char> swept_hit(num_bodies, 0);
+
+#pragma omp parallel for num_threads(nthreads_collision) if (num_bodies > 1000)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
+        auto model = body->GetCollisionModel().get();
+        if (!body->GetCollide() || !body->IsActive() || !model->GetCCD() || model->GetNumShapes() == 0)
+            continue;
+
+        // Only bodies moving by more than the swept sphere radius over the step can tunnel through other objects
+        double radius = model->GetCCDSweptSphereRadius();
+        ChVector<> disp = body->GetPos_dt() * step;
+        if (radius <= 0 || disp.Length2() <= radius * radius)
+            continue;
+
+        const ChVector<>& center = body->GetPos();
+        collision::ChCollisionSystem::ChSweephitResult result;
+        if (!collision_system->SweepSphere(center, center + disp, radius, model, result) || !result.hitModel)
+            continue;
+
+        // Discard hits with a model which the body is not approaching
+        if (Vdot(result.abs_hitNormal, disp) >= 0)
+            continue;
+
+        // Discard hits within the collision envelopes (these are already reported by the collision system)
+        ChVector<> pB = center - result.abs_hitNormal * radius;
+        double distance = Vdot(pB - result.abs_hitPoint, result.abs_hitNormal);
+        if (distance <= result.hitModel->GetEnvelope() + model->GetEnvelope())
+            continue;
+
+        auto& cinfo = swept_contacts[ip];
+        cinfo.modelA = result.hitModel;
+        cinfo.modelB = model;
+        cinfo.shapeA = result.hitShape ? result.hitShape : result.hitModel->GetShape(0).get();
+        cinfo.shapeB = model->GetShape(0).get();
+        cinfo.vpA = result.abs_hitPoint;
+        cinfo.vpB = pB;
+        cinfo.vN = result.abs_hitNormal;
+        cinfo.distance = distance;
+        swept_hit[ip] = 1;
+    }
+
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        if (swept_hit[ip])
+            contact_container->AddContact(swept_contacts[ip]);
+    }
+}
+
 // =============================================================================
 //   PHYSICAL OPERATIONS
 // =============================================================================
@@ -1531,6 +1619,7 @@ bool ChSystem::DoAssembly(int action) {
 
     solvecount = 0;
     setupcount = 0;
+    ForceJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1581,6 +1670,7 @@ bool ChSystem::DoStaticLinear() {
 
     solvecount = 0;
     setupcount = 0;
+    ForceJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1638,6 +1728,7 @@ bool ChSystem::DoStaticNonlinear(int nsteps, bool verbose) {
 
     solvecount = 0;
     setupcount = 0;
+    ForceJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1672,6 +1763,7 @@ bool ChSystem::DoStaticAnalysis(ChStaticAnalysis& analysis) {
 
     solvecount = 0;
     setupcount = 0;
+    ForceJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1695,6 +1787,7 @@ bool ChSystem::DoStaticNonlinearRheonomic(int nsteps, bool verbose, std::shared_
 
     solvecount = 0;
     setupcount = 0;
+    ForceJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -218,8 +218,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in the update and state gather/scatter of large sets of bodies, shafts, and links
+    ///                           (only if enabled with EnableParallelAssemblyUpdate),
+    ///                           and in SCM deformable terrain calculations.
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -238,6 +240,14 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int GetNumthreadsCollision() const { return nthreads_collision; }
     int GetNumthreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable the parallel update and state gather/scatter of bodies, shafts, and links (default: false).
+    /// If enabled, large sets of such items are processed with the number of Chrono threads (see SetNumThreads).
+    /// Results do not depend on the number of threads, but custom items must then be safe to update concurrently.
+    void EnableParallelAssemblyUpdate(bool val) { parallel_assembly_update = val; }
+
+    /// Return true if the parallel update of bodies, shafts, and links is enabled.
+    bool IsParallelAssemblyUpdateEnabled() const { return parallel_assembly_update; }
+
     //
     // DATABASE HANDLING
     //
@@ -277,7 +287,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     void FlushBatch() { assembly.FlushBatch(); }
 
     /// Remove a body from this assembly.
-    virtual void RemoveBody(std::shared_ptr<ChBody> body) { assembly.RemoveBody(body); }
+    /// The IDs of the bodies following the removed one are renumbered, so that body IDs remain indices in the body list.
+    virtual void RemoveBody(std::shared_ptr<ChBody> body);
 
     /// Remove a shaft from this assembly.
     virtual void RemoveShaft(std::shared_ptr<ChShaft> shaft) { assembly.RemoveShaft(shaft); }
@@ -730,6 +741,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// because the sleeping policy changed the totalDOFs and offsets.
     bool ManageSleepingBodies();
 
+    /// Generate speculative contacts for the bodies with continuous collision detection enabled (see
+    /// ChCollisionModel::SetCCD), using sphere sweep tests along the body displacements over the current step.
+    void ComputeSweptContacts();
+
     /// Performs a single dynamical simulation step, according to
     /// current values of:  Y, time, step  (and other minor settings)
     /// Depending on the integration type, it switches to one of the following:
@@ -958,6 +973,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int nthreads_chrono;
     int nthreads_eigen;
     int nthreads_collision;
+    bool parallel_assembly_update;
 
     // timers for profiling execution speed
     ChTimer timer_step;       ///< timer for integration step
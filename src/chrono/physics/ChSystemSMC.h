@@ -87,7 +87,9 @@ class ChApi ChSystemSMC : public ChSystem {
     AdhesionForceModel GetAdhesionForceModel() const { return m_adhesion_model; }
 
     /// Set the tangential displacement model.
-    /// Note that currently MultiStep falls back to OneStep.
+    /// With the MultiStep model, the contact container keeps, for each persistent contact, the tangential (shear)
+    /// displacement accumulated since contact initiation. This history is passed to the contact force algorithm (see
+    /// ChContactForceSMC::CalculateForceWithHistory) and is discarded as soon as the contact is no longer reported.
     void SetTangentialDisplacementModel(TangentialDisplacementModel model) { m_tdispl_model = model; }
     /// Get the current tangential displacement model.
     TangentialDisplacementModel GetTangentialDisplacementModel() const { return m_tdispl_model; }
@@ -129,6 +131,27 @@ class ChApi ChSystemSMC : public ChSystem {
             double mass1,                       ///< mass of obj1
             double mass2                        ///< mass of obj2
             ) const = 0;
+
+        /// Calculate contact force for a contact with history (used with the MultiStep tangential displacement
+        /// model). The provided tangential displacement, accumulated since contact initiation (expressed in global
+        /// frame), should be updated by the implementation. The default implementation ignores the contact history
+        /// and invokes CalculateForce.
+        virtual ChVector<> CalculateForceWithHistory(
+            const ChSystemSMC& sys,             ///< containing system
+            const ChVector<>& normal_dir,       ///< normal contact direction (expressed in global frame)
+            const ChVector<>& p1,               ///< most penetrated point on obj1 (expressed in global frame)
+            const ChVector<>& p2,               ///< most penetrated point on obj2 (expressed in global frame)
+            const ChVector<>& vel1,             ///< velocity of contact point on obj1 (expressed in global frame)
+            const ChVector<>& vel2,             ///< velocity of contact point on obj2 (expressed in global frame)
+            const ChMaterialCompositeSMC& mat,  ///< composite material for contact pair
+            double delta,                       ///< overlap in normal direction
+            double eff_radius,                  ///< effective radius of curvature at contact
+            double mass1,                       ///< mass of obj1
+            double mass2,                       ///< mass of obj2
+            ChVector<>& tangential_displ        ///< [in/out] accumulated tangential displacement
+            ) const {
+            return CalculateForce(sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1, mass2);
+        }
     };
 
     /// Change the default SMC contact force calculation.
@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChCompiledConstraints.h"
+#include "chrono/solver/ChConstraintTwoGenericBoxed.h"
+#include "chrono/solver/ChConstraintTwoTuplesRollingN.h"
+#include "chrono/solver/ChConstraintTwoTuplesRollingT.h"
+
+namespace chrono {
+
+void ChCompiledConstraints::Build(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+
+    // Collect the active constraints and classify their projection
+    m_constraints.clear();
+    m_proj.clear();
+    for (auto constraint : mconstraints) {
+        if (!constraint->IsActive())
+            continue;
+        m_constraints.push_back(constraint);
+        switch (constraint->GetMode()) {
+            case CONSTRAINT_FRIC:
+                // The rolling reactions of a rolling contact follow its normal and sliding reactions
+                // (see ChContactNSCrolling::InjectConstraints)
+                if (dynamic_cast<ChConstraintTwoTuplesRollingNall*>(constraint) ||
+                    dynamic_cast<ChConstraintTwoTuplesRollingTall*>(constraint)) {
+                    assert(m_proj.size() >= 3 && m_proj[m_proj.size() - 3] == FRICTION);
+                    m_proj.push_back(ROLLING);
+                } else {
+                    m_proj.push_back(FRICTION);
+                }
+                break;
+            case CONSTRAINT_UNILATERAL:
+                m_proj.push_back(dynamic_cast<ChConstraintTwoGenericBoxed*>(constraint) ? GENERIC : UNILATERAL);
+                break;
+            default:
+                m_proj.push_back(dynamic_cast<ChConstraintTwoGenericBoxed*>(constraint) ? GENERIC : NONE);
+                break;
+        }
+    }
+
+    int nc = (int)m_constraints.size();
+    n_q = sysd.CountActiveVariables();  // also makes sure that variable offsets are up to date
+
+    // Count the non-zeros in each Jacobian row, so that the rows can be filled without reallocations
+    std::vector<ChVariables*> vars;
+    Eigen::VectorXi nnz_row(nc);
+    for (int i = 0; i < nc; i++) {
+        vars.clear();
+        m_constraints[i]->AppendVariables(vars);
+        int nnz = 0;
+        for (auto var : vars) {
+            if (var && var->IsActive())
+                nnz += var->Get_ndof();
+        }
+        nnz_row(i) = nnz;
+    }
+
+    // Assemble the Jacobian rows in compressed row storage
+    m_Cq.resize(nc, n_q);
+    m_Cq.setZero();
+    m_Cq.reserve(nnz_row);
+    for (int i = 0; i < nc; i++)
+        m_constraints[i]->Build_Cq(m_Cq, i);
+    m_Cq.makeCompressed();
+
+    // Compute the values of [Eq_i]' = [Cq_i]*[invM] on the same sparsity pattern.
+    // Each active variable occupies a contiguous range of columns in a Jacobian row.
+    const int* row_ptr = m_Cq.outerIndexPtr();
+    const int* col = m_Cq.innerIndexPtr();
+    const double* Cq = m_Cq.valuePtr();
+    m_Eq.assign(m_Cq.nonZeros(), 0.0);
+    for (int i = 0; i < nc; i++) {
+        vars.clear();
+        m_constraints[i]->AppendVariables(vars);
+        for (auto var : vars) {
+            if (!var || !var->IsActive())
+                continue;
+            int k = (int)(std::lower_bound(col + row_ptr[i], col + row_ptr[i + 1], var->GetOffset()) - col);
+            int ndof = var->Get_ndof();
+            assert(k + ndof <= row_ptr[i + 1] && col[k] == var->GetOffset());
+            Eigen::Map<ChVectorDynamic<>> Eq_var(&m_Eq[k], ndof);
+            Eigen::Map<const ChVectorDynamic<>> Cq_var(&Cq[k], ndof);
+            var->Compute_invMb_v(Eq_var, Cq_var);
+        }
+    }
+
+    // Pack the constraint scalars
+    m_g.resize(nc);
+    m_b.resize(nc);
+    m_cfm.resize(nc);
+    m_l.resize(nc);
+    for (int i = 0; i < nc; i++) {
+        m_g(i) = m_constraints[i]->Get_g_i();
+        m_b(i) = m_constraints[i]->Get_b_i();
+        m_cfm(i) = m_constraints[i]->Get_cfm_i();
+        m_l(i) = m_constraints[i]->Get_l_i();
+    }
+
+    m_q.setZero(n_q);
+}
+
+void ChCompiledConstraints::ConstraintsProject(ChVectorDynamic<>& multipliers) {
+    assert(multipliers.size() == GetNumConstraints());
+
+    m_l.swap(multipliers);
+    int nc = GetNumConstraints();
+    for (int i = 0; i < nc;) {
+        Project(i);
+        i += IsFriction(i) ? 3 : 1;
+    }
+    m_l.swap(multipliers);
+}
+
+void ChCompiledConstraints::ShurComplementProduct(ChVectorDynamic<>& result, const ChVectorDynamic<>& lvector) {
+    assert(lvector.size() == GetNumConstraints());
+
+    // q = [M^(-1)][Cq']*l
+    m_q.setZero(n_q);
+    int nc = GetNumConstraints();
+    for (int i = 0; i < nc; i++)
+        Increment_q(i, lvector(i));
+
+    // result = [Cq]*q + [E]*l
+    ComputeCqq(result);
+    result += m_cfm.cwiseProduct(lvector);
+}
+
+void ChCompiledConstraints::ComputeCqq(ChVectorDynamic<>& result) const {
+    // sparse matrix-vector product on the packed Jacobian
+    result.noalias() = m_Cq * m_q;
+}
+
+void ChCompiledConstraints::FromVariablesToQ(ChSystemDescriptor& sysd) {
+    m_q.resize(n_q);
+    for (auto var : sysd.GetVariablesList()) {
+        if (var->IsActive())
+            m_q.segment(var->GetOffset(), var->Get_ndof()) = var->Get_qb();
+    }
+}
+
+void ChCompiledConstraints::FromQToVariables(ChSystemDescriptor& sysd) const {
+    for (auto var : sysd.GetVariablesList()) {
+        if (var->IsActive())
+            var->Get_qb() = m_q.segment(var->GetOffset(), var->Get_ndof());
+    }
+}
+
+void ChCompiledConstraints::FromLToConstraints() const {
+    int nc = GetNumConstraints();
+    for (int i = 0; i < nc; i++)
+        m_constraints[i]->Set_l_i(m_l(i));
+}
+
+}  // end namespace chrono
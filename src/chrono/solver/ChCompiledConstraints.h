@@ -0,0 +1,181 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#ifndef CH_COMPILED_CONSTRAINTS_H
+#define CH_COMPILED_CONSTRAINTS_H
+
+#include <vector>
+
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Flattened, structure-of-arrays representation of the active constraints in a ChSystemDescriptor.\n
+/// The Jacobian rows [Cq_i] and the auxiliary vectors [Eq_i]=[invM]*[Cq_i]' of all active constraints are packed in
+/// a compressed sparse row layout (with a common sparsity pattern), while g_i, b_i, cfm_i and l_i are stored in
+/// contiguous vectors. The speeds q of all active variables are gathered in a single vector. Iterative VI solvers can
+/// then operate on these buffers with tight loops, instead of virtual calls per constraint and per variable.\n
+/// The compiled data is a snapshot: it must be rebuilt (see Build) at each solve, after the auxiliary data of the
+/// constraints was updated (see ChConstraint::Update_auxiliary), and results must be copied back to the descriptor.
+/// The stiffness blocks (ChKblock) in the descriptor, if any, are ignored.
+class ChApi ChCompiledConstraints {
+  public:
+    ChCompiledConstraints() : n_q(0) {}
+
+    /// Pack the active constraints and variables of the given descriptor.
+    /// Must be called after Update_auxiliary() was invoked for all constraints (that is, when g_i and Eq_i are up to
+    /// date). The current multipliers l_i are also loaded. The q vector is set to zero.
+    void Build(ChSystemDescriptor& sysd);
+
+    /// Return the number of packed (active) constraints.
+    int GetNumConstraints() const { return (int)m_constraints.size(); }
+
+    /// Return the number of active degrees of freedom (size of the q vector).
+    int GetNumVariables() const { return n_q; }
+
+    /// Access the i-th packed constraint.
+    ChConstraint* GetConstraint(int i) const { return m_constraints[i]; }
+
+    /// Return true if the i-th constraint is one of the three reactions of a frictional contact (including the rolling
+    /// and spinning reactions of a rolling contact).
+    bool IsFriction(int i) const { return m_proj[i] == FRICTION || m_proj[i] == ROLLING; }
+
+    double Get_g_i(int i) const { return m_g(i); }
+    double Get_b_i(int i) const { return m_b(i); }
+    double Get_cfm_i(int i) const { return m_cfm(i); }
+    void Set_g_i(int i, double g) { m_g(i) = g; }
+
+    /// Access the vector of multipliers of the packed constraints.
+    ChVectorDynamic<>& L() { return m_l; }
+
+    /// Access the vector of speeds of the active variables.
+    ChVectorDynamic<>& Q() { return m_q; }
+
+    /// Compute the product [Cq_i]*q for the i-th constraint.
+    double Compute_Cq_q(int i) const {
+        const int* col = m_Cq.innerIndexPtr();
+        const double* Cq = m_Cq.valuePtr();
+        const double* q = m_q.data();
+        double ret = 0;
+        for (int k = m_Cq.outerIndexPtr()[i]; k < m_Cq.outerIndexPtr()[i + 1]; k++)
+            ret += Cq[k] * q[col[k]];
+        return ret;
+    }
+
+    /// Increment the speeds by [Eq_i]*deltal for the i-th constraint.
+    void Increment_q(int i, double deltal) {
+        const int* col = m_Cq.innerIndexPtr();
+        const double* Eq = m_Eq.data();
+        double* q = m_q.data();
+        for (int k = m_Cq.outerIndexPtr()[i]; k < m_Cq.outerIndexPtr()[i + 1]; k++)
+            q[col[k]] += Eq[k] * deltal;
+    }
+
+    /// Compute the constraint violation for the given residual of the i-th constraint (see ChConstraint::Violation).
+    double Violation(int i, double mc_i) const {
+        switch (m_proj[i]) {
+            case NONE:
+                return mc_i;
+            case UNILATERAL:
+                return (mc_i > 0.) ? 0. : mc_i;
+            default:
+                return m_constraints[i]->Violation(mc_i);
+        }
+    }
+
+    /// Project the multiplier of the i-th constraint onto its admissible set.
+    /// For frictional contacts, this must be called for the normal component (the first of the three reactions) and
+    /// it projects all three multipliers at once (see ChConstraint::Project). For the rolling and spinning reactions of
+    /// a rolling contact, this must be called for the spinning component and it may also modify the normal reaction.
+    void Project(int i) {
+        switch (m_proj[i]) {
+            case NONE:
+                break;
+            case UNILATERAL:
+                if (m_l(i) < 0.)
+                    m_l(i) = 0.;
+                break;
+            case FRICTION:
+                for (int j = i; j < i + 3; j++)
+                    m_constraints[j]->Set_l_i(m_l(j));
+                m_constraints[i]->Project();
+                for (int j = i; j < i + 3; j++)
+                    m_l(j) = m_constraints[j]->Get_l_i();
+                break;
+            case ROLLING:
+                // The projection also modifies the normal reaction of the contact, three rows earlier
+                m_constraints[i - 3]->Set_l_i(m_l(i - 3));
+                for (int j = i; j < i + 3; j++)
+                    m_constraints[j]->Set_l_i(m_l(j));
+                m_constraints[i]->Project();
+                m_l(i - 3) = m_constraints[i - 3]->Get_l_i();
+                for (int j = i; j < i + 3; j++)
+                    m_l(j) = m_constraints[j]->Get_l_i();
+                break;
+            default:
+                m_constraints[i]->Set_l_i(m_l(i));
+                m_constraints[i]->Project();
+                m_l(i) = m_constraints[i]->Get_l_i();
+                break;
+        }
+    }
+
+    /// Project the given vector of multipliers onto the admissible set (see ChSystemDescriptor::ConstraintsProject).
+    void ConstraintsProject(ChVectorDynamic<>& multipliers);
+
+    /// Compute result = [N]*l = [ [Cq][M^(-1)][Cq'] + [E] ]*l (see ChSystemDescriptor::ShurComplementProduct).
+    /// This uses the q vector as temporary storage.
+    void ShurComplementProduct(ChVectorDynamic<>& result, const ChVectorDynamic<>& lvector);
+
+    /// Compute result = [Cq]*q, for all packed constraints.
+    void ComputeCqq(ChVectorDynamic<>& result) const;
+
+    /// Gather the speeds qb of all active variables of the descriptor into the q vector.
+    void FromVariablesToQ(ChSystemDescriptor& sysd);
+
+    /// Scatter the q vector into the speeds qb of all active variables of the descriptor.
+    void FromQToVariables(ChSystemDescriptor& sysd) const;
+
+    /// Copy the multipliers l_i into the packed constraints.
+    void FromLToConstraints() const;
+
+  private:
+    enum ProjectionType {
+        NONE,        ///< bilateral constraint, no projection
+        UNILATERAL,  ///< unilateral constraint, l_i >= 0
+        FRICTION,    ///< one of the three reactions of a frictional contact
+        ROLLING,     ///< one of the three rolling/spinning reactions of a rolling contact
+        GENERIC      ///< any other constraint (projection through the constraint object)
+    };
+
+    int n_q;                                   ///< number of active degrees of freedom
+    std::vector<ChConstraint*> m_constraints;  ///< packed (active) constraints
+    std::vector<char> m_proj;                  ///< projection type of each packed constraint
+    ChSparseMatrix m_Cq;                       ///< Jacobian rows (CSR, defines the common sparsity pattern)
+    std::vector<double> m_Eq;                  ///< values of [Eq_i]' on the sparsity pattern of m_Cq
+    ChVectorDynamic<> m_g;                     ///< g_i values
+    ChVectorDynamic<> m_b;                     ///< b_i values
+    ChVectorDynamic<> m_cfm;                   ///< cfm_i values
+    ChVectorDynamic<> m_l;                     ///< l_i values
+    ChVectorDynamic<> m_q;                     ///< speeds of the active variables
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -69,6 +69,13 @@ class ChApi ChConstraintThree : public ChConstraint {
     /// Access the second variable object.
     ChVariables* GetVariables_c() { return variables_c; }
 
+    /// Append to the given list the three variable objects referenced by this constraint.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const override {
+        vars.push_back(variables_a);
+        vars.push_back(variables_b);
+        vars.push_back(variables_c);
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b, ChVariables* mvariables_c) = 0;
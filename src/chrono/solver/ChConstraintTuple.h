@@ -113,6 +113,10 @@ class ChConstraintTuple_1vars {
         }
     }
 
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables);
+    }
+
     void Build_Cq(ChSparseMatrix& storage, int insrow) {
         if (variables->IsActive())
             PasteMatrix(storage, Cq, insrow, variables->GetOffset());
@@ -250,6 +254,11 @@ class ChConstraintTuple_2vars {
         }
     }
 
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+    }
+
     void Build_Cq(ChSparseMatrix& storage, int insrow) {
         if (variables_1->IsActive())
             PasteMatrix(storage, Cq_1, insrow, variables_1->GetOffset());
@@ -427,6 +436,12 @@ class ChConstraintTuple_3vars {
         }
     }
 
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+    }
+
     void Build_Cq(ChSparseMatrix& storage, int insrow) {
         if (variables_1->IsActive())
             PasteMatrix(storage, Cq_1, insrow, variables_1->GetOffset());
@@ -645,6 +660,13 @@ class ChConstraintTuple_4vars {
         }
     }
 
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+        vars.push_back(variables_4);
+    }
+
     void Build_Cq(ChSparseMatrix& storage, int insrow) {
         if (variables_1->IsActive())
             PasteMatrix(storage, Cq_1, insrow, variables_1->GetOffset());
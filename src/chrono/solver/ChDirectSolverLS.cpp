@@ -12,8 +12,11 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/utils/ChOpenMP.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
 
@@ -23,6 +26,8 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_parallel_assembly(false),
+      m_nthreads(ChOMP::GetNumProcs()),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -30,13 +35,42 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_analyze_call(0) {}
+
+void ChDirectSolverLS::SetNumThreads(int nthreads) {
+    m_nthreads = std::max(1, nthreads);
+}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
     m_timer_setup_solvercall.reset();
     m_timer_solve_assembly.reset();
     m_timer_solve_solvercall.reset();
+    m_timer_setup_analyze.reset();
+}
+
+bool ChDirectSolverLS::SparsityPatternChanged() {
+    assert(m_mat.isCompressed());
+
+    auto n = m_mat.outerSize();
+    auto nnz = m_mat.nonZeros();
+    const int* outer = m_mat.outerIndexPtr();
+    const int* inner = m_mat.innerIndexPtr();
+
+    if (m_pattern_outer.size() == (size_t)(n + 1) && m_pattern_inner.size() == (size_t)nnz &&
+        std::equal(m_pattern_outer.begin(), m_pattern_outer.end(), outer) &&
+        std::equal(m_pattern_inner.begin(), m_pattern_inner.end(), inner))
+        return false;
+
+    m_pattern_outer.assign(outer, outer + n + 1);
+    m_pattern_inner.assign(inner, inner + nnz);
+    return true;
+}
+
+void ChDirectSolverLS::ResetSparsityPattern() {
+    m_pattern_outer.clear();
+    m_pattern_inner.clear();
 }
 
 bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
@@ -71,14 +105,20 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
         sparsity_pattern.Apply(m_mat);
         m_force_update = false;
+        m_kmap.Reset();
     } else if (call_reserve) {
         double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
         m_mat.resize(m_dim, m_dim);
         m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.ConvertToMatrixForm(&m_mat, nullptr);
+    // Let the system descriptor load the current matrix.
+    // With a locked sparsity pattern, use the parallel assembly (if enabled) into the existing matrix structure.
+    bool assembled = false;
+    if (m_parallel_assembly && m_lock)
+        assembled = sysd.ConvertToMatrixFormParallel(m_mat, m_kmap, m_nthreads);
+    if (!assembled)
+        sysd.ConvertToMatrixForm(&m_mat, nullptr);
 
     // Allow the matrix to be compressed
     m_mat.makeCompressed();
@@ -100,7 +140,8 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         GetLog() << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
                  << "\n";
         GetLog() << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSecondsIntermediate() << "s\n"
-                 << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "s\n";
+                 << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "s\n"
+                 << "  symbolic analyses: " << m_analyze_call << "\n";
     }
 
     m_setup_call++;
@@ -265,8 +306,22 @@ void ChDirectSolverLS::ArchiveIN(ChArchiveIn& marchive) {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseLU::FactorizeMatrix() {
-    m_engine.compute(m_mat);
-    return (m_engine.info() == Eigen::Success);
+    // Redo the symbolic analysis only if the sparsity pattern changed
+    if (SparsityPatternChanged()) {
+        m_timer_setup_analyze.start();
+        m_engine.analyzePattern(m_mat);
+        m_timer_setup_analyze.stop();
+        m_analyze_call++;
+    }
+
+    m_engine.factorize(m_mat);
+
+    // On failure, make sure a new symbolic analysis is performed at the next call
+    if (m_engine.info() != Eigen::Success) {
+        ResetSparsityPattern();
+        return false;
+    }
+    return true;
 }
 
 bool ChSolverSparseLU::SolveSystem() {
@@ -294,8 +349,22 @@ void ChSolverSparseLU::PrintErrorMessage() {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseQR::FactorizeMatrix() {
-    m_engine.compute(m_mat);
-    return (m_engine.info() == Eigen::Success);
+    // Redo the symbolic analysis only if the sparsity pattern changed
+    if (SparsityPatternChanged()) {
+        m_timer_setup_analyze.start();
+        m_engine.analyzePattern(m_mat);
+        m_timer_setup_analyze.stop();
+        m_analyze_call++;
+    }
+
+    m_engine.factorize(m_mat);
+
+    // On failure, make sure a new symbolic analysis is performed at the next call
+    if (m_engine.info() != Eigen::Success) {
+        ResetSparsityPattern();
+        return false;
+    }
+    return true;
 }
 
 bool ChSolverSparseQR::SolveSystem() {
@@ -18,6 +18,7 @@
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
+#include "chrono/solver/ChSparseAssemblyMap.h"
 
 #include <Eigen/SparseLU>
 
@@ -87,6 +88,17 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Disable for smaller problems where the overhead may be too large.
     void UseSparsityPatternLearner(bool val) { m_use_learner = val; }
 
+    /// Enable/disable parallel assembly of the problem matrix (default: false).\n
+    /// If enabled and the sparsity pattern is locked, the stiffness blocks (ChKblock) are loaded in parallel, through
+    /// a precomputed map into the compressed storage of the matrix (see ChSparseAssemblyMap). The map is recomputed
+    /// only if the problem structure changes. If the locked sparsity pattern does not include all stiffness entries,
+    /// the serial assembly is used.
+    void UseParallelAssembly(bool val) { m_parallel_assembly = val; }
+
+    /// Set the number of OpenMP threads used for the parallel matrix assembly (default: number of available
+    /// processors). Note that ChSystem::SetNumThreads sets this value to the number of Chrono threads.
+    void SetNumThreads(int nthreads);
+
     /// Force a call to the sparsity pattern learner to update sparsity pattern on the underlying matrix.\n
     /// Such a call may be needed in a situation where the sparsity pattern is locked, but a change in the problem size
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
@@ -122,11 +134,18 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     double GetTimeSetup_Assembly() const { return m_timer_setup_assembly(); }
     /// Get cumulative time for Pardiso calls in Setup phase.
     double GetTimeSetup_SolverCall() const { return m_timer_setup_solvercall(); }
+    /// Get cumulative time for symbolic analysis in Setup phase (included in GetTimeSetup_SolverCall).
+    /// Only reported by solvers which separate the symbolic and numeric factorization phases.
+    double GetTimeSetup_SolverAnalyze() const { return m_timer_setup_analyze(); }
 
     /// Return the number of calls to the solver's Setup function.
     int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of symbolic analyses of the matrix sparsity pattern performed in the Setup phase.
+    /// Only reported by solvers which separate the symbolic and numeric factorization phases; for these, the symbolic
+    /// analysis is reused for all calls to Setup with an unchanged sparsity pattern.
+    int GetNumAnalyzeCalls() const { return m_analyze_call; }
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
@@ -187,6 +206,13 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Typically, direct solvers only require the matrix for their #Setup() phase.
     virtual bool SolveRequiresMatrix() const override { return false; }
 
+    /// Return true if the sparsity pattern of the (compressed) problem matrix changed since the last call, in which
+    /// case a new symbolic analysis is required. The current pattern is recorded for the next check.
+    bool SparsityPatternChanged();
+
+    /// Discard the recorded sparsity pattern, forcing a new symbolic analysis at the next factorization.
+    void ResetSparsityPattern();
+
     ChSparseMatrix m_mat;           ///< problem matrix
     int m_dim;                      ///< problem size
     MatrixSymmetryType m_symmetry;  ///< symmetry of problem matrix
@@ -194,13 +220,18 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChVectorDynamic<double> m_rhs;  ///< right-hand side vector
     ChVectorDynamic<double> m_sol;  ///< solution vector
 
-    int m_solve_call;  ///< counter for calls to Solve
-    int m_setup_call;  ///< counter for calls to Setup
+    int m_solve_call;    ///< counter for calls to Solve
+    int m_setup_call;    ///< counter for calls to Setup
+    int m_analyze_call;  ///< counter for symbolic analyses
 
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
 
+    bool m_parallel_assembly;    ///< use parallel matrix assembly (if pattern locked)?
+    int m_nthreads;              ///< number of threads for parallel matrix assembly
+    ChSparseAssemblyMap m_kmap;  ///< scatter map for parallel assembly of the stiffness blocks
+
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
@@ -209,8 +240,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChTimer m_timer_setup_solvercall;  ///< timer for factorization
     ChTimer m_timer_solve_assembly;    ///< timer for RHS assembly
     ChTimer m_timer_solve_solvercall;  ///< timer for solution
+    ChTimer m_timer_setup_analyze;     ///< timer for symbolic analysis (part of factorization)
 
   private:
+    std::vector<int> m_pattern_outer;  ///< recorded sparsity pattern (row starts)
+    std::vector<int> m_pattern_inner;  ///< recorded sparsity pattern (column indices)
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
 };
@@ -219,6 +254,8 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
 
 /// Sparse LU direct solver.\n
 /// Interface to Eigen's SparseLU solver, a supernodal LU factorization for general matrices.\n
+/// The symbolic analysis (COLAMD ordering and elimination tree) is performed only when the matrix sparsity pattern
+/// changes; otherwise, only the numeric factorization is recomputed (see ChDirectSolverLS::LockSparsityPattern).\n
 /// Cannot handle VI and complementarity problems, so it cannot be used with NSC formulations.\n
 /// See ChDirectSolverLS for more details.
 class ChApi ChSolverSparseLU : public ChDirectSolverLS {
@@ -244,6 +281,8 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
 
 /// Sparse QR direct solver.\n
 /// Interface to Eigen's SparseQR solver, a left-looking rank-revealing QR factorization.\n
+/// The symbolic analysis (COLAMD ordering and elimination tree) is performed only when the matrix sparsity pattern
+/// changes; otherwise, only the numeric factorization is recomputed (see ChDirectSolverLS::LockSparsityPattern).\n
 /// Cannot handle VI and complementarity problems, so it cannot be used with NSC formulations.\n
 /// See ChDirectSolverLS for more details.
 class ChApi ChSolverSparseQR : public ChDirectSolverLS {
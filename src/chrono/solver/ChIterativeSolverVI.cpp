@@ -21,6 +21,7 @@ ChIterativeSolverVI::ChIterativeSolverVI()
       m_omega(1.0),
       m_shlambda(1.0),
       m_iterations(0),
+      m_use_compiled(false),
       record_violation_history(false) {}
 
 void ChIterativeSolverVI::SetOmega(double mval) {
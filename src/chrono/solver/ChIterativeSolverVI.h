@@ -16,6 +16,7 @@
 #define CH_ITERATIVESOLVER_VI_H
 
 #include "chrono/solver/ChSolverVI.h"
+#include "chrono/solver/ChCompiledConstraints.h"
 #include "chrono/solver/ChIterativeSolver.h"
 
 namespace chrono {
@@ -73,6 +74,16 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// GetViolationHistory).
     void SetRecordViolation(bool mval) { record_violation_history = mval; }
 
+    /// Enable/disable the use of a compiled representation of the constraints (default: false).
+    /// If enabled, at each solve the Jacobians, auxiliary vectors and scalars of all active constraints are packed in
+    /// contiguous buffers (see ChCompiledConstraints) and the iterations operate on these buffers rather than through
+    /// virtual calls on the individual constraints and variables. This is currently supported by ChSolverPSOR and
+    /// ChSolverAPGD, and ignored by other solvers.
+    void EnableCompiledConstraints(bool val) { m_use_compiled = val; }
+
+    /// Return true if the solver uses a compiled representation of the constraints.
+    bool UsingCompiledConstraints() const { return m_use_compiled; }
+
     /// Return the current value of the overrelaxation factor.
     double GetOmega() const { return m_omega; }
 
@@ -113,6 +124,9 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     double m_omega;     ///< over-relaxation factor
     double m_shlambda;  ///< sharpness factor
 
+    bool m_use_compiled;                ///< use a compiled representation of the constraints?
+    ChCompiledConstraints m_compiled;  ///< compiled constraints (if m_use_compiled)
+
     bool record_violation_history;
     std::vector<double> violation_history;
     std::vector<double> dlambda_history;
@@ -35,6 +35,7 @@ class my_enum_mappers : public ChSolver {
     CH_ENUM_VAL(Type::MINRES);
     CH_ENUM_VAL(Type::BICGSTAB);
     CH_ENUM_VAL(Type::CUSTOM);
+    CH_ENUM_VAL(Type::PSOR_COLORED);
     CH_ENUM_MAPPER_END(Type);
 };
 
@@ -53,6 +53,8 @@ class ChApi ChSolver {
         BICGSTAB,  ///< Bi-conjugate gradient stabilized
         // Other
         CUSTOM,
+        // Iterative VI solvers (continued)
+        PSOR_COLORED,  ///< Projected SOR with parallel sweeps over a coloring of the constraint graph
     };
 
     virtual ~ChSolver() {}
@@ -46,13 +46,18 @@ void ChSolverAPGD::ShurBvectorCompute(ChSystemDescriptor& sysd) {
                                                          sysd.GetVariablesList()[iv]->Get_fb());  // q = [M]'*fb
 
     // ...and now do  b_shur = - D'*q = - D'*(M^-1)*k ..
-    r.setZero();
-    int s_i = 0;
-    for (unsigned int ic = 0; ic < sysd.GetConstraintsList().size(); ic++)
-        if (sysd.GetConstraintsList()[ic]->IsActive()) {
-            r(s_i, 0) = sysd.GetConstraintsList()[ic]->Compute_Cq_q();
-            ++s_i;
-        }
+    if (m_use_compiled) {
+        m_compiled.FromVariablesToQ(sysd);
+        m_compiled.ComputeCqq(r);
+    } else {
+        r.setZero();
+        int s_i = 0;
+        for (unsigned int ic = 0; ic < sysd.GetConstraintsList().size(); ic++)
+            if (sysd.GetConstraintsList()[ic]->IsActive()) {
+                r(s_i, 0) = sysd.GetConstraintsList()[ic]->Compute_Cq_q();
+                ++s_i;
+            }
+    }
 
     // ..and finally do   b_shur = b_shur - c
     sysd.BuildBiVector(tmp);  // b_i   =   -c   = phi/h
@@ -63,10 +68,10 @@ double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
     // Project the gradient (for rollback strategy)
     // g_proj = (l-project_orthogonal(l - gdiff*g, fric))/gdiff;
     double gdiff = 1.0 / (nc * nc);
-    sysd.ShurComplementProduct(tmp, gammaNew);  // tmp = N * gammaNew
-    tmp = gammaNew - gdiff * (tmp + r);         // Note: no aliasing issues here
-    sysd.ConstraintsProject(tmp);               // tmp = ProjectionOperator(gammaNew - gdiff * g)
-    tmp = (gammaNew - tmp) / gdiff;             // Note: no aliasing issues here
+    ShurComplementProduct(sysd, tmp, gammaNew);  // tmp = N * gammaNew
+    tmp = gammaNew - gdiff * (tmp + r);          // Note: no aliasing issues here
+    ConstraintsProject(sysd, tmp);               // tmp = ProjectionOperator(gammaNew - gdiff * g)
+    tmp = (gammaNew - tmp) / gdiff;              // Note: no aliasing issues here
 
     return tmp.norm();
 }
@@ -84,6 +89,10 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Pack constraints and variables in contiguous buffers
+    if (m_use_compiled)
+        m_compiled.Build(sysd);
+
     double L, t;
     double theta;
     double thetaNew;
@@ -118,18 +127,27 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     // Optimization: backup the  q  sparse data computed above,
     // because   (M^-1)*k   will be needed at the end when computing primals.
     ChVectorDynamic<> Minvk;
-    sysd.FromVariablesToVector(Minvk, true);
+    if (m_use_compiled)
+        Minvk = m_compiled.Q();
+    else
+        sysd.FromVariablesToVector(Minvk, true);
 
     // (1) gamma_0 = zeros(nc,1)
-    if (m_warm_start) {
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
-            if (mconstraints[ic]->IsActive())
-                mconstraints[ic]->Increment_q(mconstraints[ic]->Get_l_i());
+    if (m_use_compiled) {
+        if (!m_warm_start)
+            m_compiled.L().setZero();
+        gamma = m_compiled.L();
     } else {
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
-            mconstraints[ic]->Set_l_i(0.);
+        if (m_warm_start) {
+            for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+                if (mconstraints[ic]->IsActive())
+                    mconstraints[ic]->Increment_q(mconstraints[ic]->Get_l_i());
+        } else {
+            for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+                mconstraints[ic]->Set_l_i(0.);
+        }
+        sysd.FromConstraintsToVector(gamma);
     }
-    sysd.FromConstraintsToVector(gamma);
 
     // (2) gamma_hat_0 = ones(nc,1)
     gamma_hat.setConstant(1.0);
@@ -143,7 +161,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     // (5) L_k = norm(N * (gamma_0 - gamma_hat_0)) / norm(gamma_0 - gamma_hat_0)
     tmp = gamma - gamma_hat;
     L = tmp.norm();
-    sysd.ShurComplementProduct(yNew, tmp, nullptr);  // yNew = N * tmp = N * (gamma - gamma_hat)
+    ShurComplementProduct(sysd, yNew, tmp);  // yNew = N * tmp = N * (gamma - gamma_hat)
     L = yNew.norm() / L;
     yNew.setZero();  //// RADU  is this really necessary here?
 
@@ -157,16 +175,16 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     for (m_iterations = 0; m_iterations < m_max_iterations; m_iterations++) {
         // (8) g = N * y_k - r
         // (9) gamma_(k+1) = ProjectionOperator(y_k - t_k * g)
-        sysd.ShurComplementProduct(g, y);  // g = N * y
+        ShurComplementProduct(sysd, g, y);  // g = N * y
         gammaNew = y - t * (g + r);
-        sysd.ConstraintsProject(gammaNew);
+        ConstraintsProject(sysd, gammaNew);
 
         // (10) while 0.5 * gamma_(k+1)' * N * gamma_(k+1) - gamma_(k+1)' * r >=
         //            0.5 * y_k' * N * y_k - y_k' * r + g' * (gamma_(k+1) - y_k) + 0.5 * L_k * norm(gamma_(k+1) - y_k)^2
-        sysd.ShurComplementProduct(tmp, gammaNew);  // tmp = N * gammaNew;
+        ShurComplementProduct(sysd, tmp, gammaNew);  // tmp = N * gammaNew;
         obj1 = gammaNew.dot(0.5 * tmp + r);
 
-        sysd.ShurComplementProduct(tmp, y);  // tmp = N * y;
+        ShurComplementProduct(sysd, tmp, y);  // tmp = N * y;
         obj2 = y.dot(0.5 * tmp + r) + (gammaNew - y).dot(g + 0.5 * L * (gammaNew - y));
 
         while (obj1 >= obj2) {
@@ -178,13 +196,13 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
 
             // (13) gamma_(k+1) = ProjectionOperator(y_k - t_k * g)
             gammaNew = y - t * g;
-            sysd.ConstraintsProject(gammaNew);
+            ConstraintsProject(sysd, gammaNew);
 
             // Update obj1 and obj2
-            sysd.ShurComplementProduct(tmp, gammaNew);  // tmp = N * gammaNew;
+            ShurComplementProduct(sysd, tmp, gammaNew);  // tmp = N * gammaNew;
             obj1 = gammaNew.dot(0.5 * tmp + r);
 
-            sysd.ShurComplementProduct(tmp, y);  // tmp = N * y;
+            ShurComplementProduct(sysd, tmp, y);  // tmp = N * y;
             obj2 = y.dot(0.5 * tmp + r) + (gammaNew - y).dot(g + 0.5 * L * (gammaNew - y));
         }  // (14) endwhile
 
@@ -235,6 +253,17 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
         std::cout << "Residual: " << residual << ", Iter: " << m_iterations << std::endl;
 
     // (33) return Value at time step t_(l+1), gamma_(l+1) := gamma_hat
+    if (m_use_compiled) {
+        // v = (M^-1)*k + (M^-1)*D*l
+        m_compiled.L() = gamma_hat;
+        m_compiled.FromLToConstraints();
+        m_compiled.Q() = Minvk;
+        for (int ic = 0; ic < nc; ic++)
+            m_compiled.Increment_q(ic, gamma_hat(ic));
+        m_compiled.FromQToVariables(sysd);
+        return residual;
+    }
+
     sysd.FromVectorToConstraints(gamma_hat);
 
     // Resulting PRIMAL variables:
@@ -251,6 +280,22 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     return residual;
 }
 
+void ChSolverAPGD::ShurComplementProduct(ChSystemDescriptor& sysd,
+                                         ChVectorDynamic<>& result,
+                                         const ChVectorDynamic<>& l) {
+    if (m_use_compiled)
+        m_compiled.ShurComplementProduct(result, l);
+    else
+        sysd.ShurComplementProduct(result, l, nullptr);
+}
+
+void ChSolverAPGD::ConstraintsProject(ChSystemDescriptor& sysd, ChVectorDynamic<>& l) {
+    if (m_use_compiled)
+        m_compiled.ConstraintsProject(l);
+    else
+        sysd.ConstraintsProject(l);
+}
+
 void ChSolverAPGD::Dump_Rhs(std::vector<double>& temp) {
     for (int i = 0; i < r.size(); i++) {
         temp.push_back(r(i));
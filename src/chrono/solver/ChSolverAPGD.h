@@ -48,6 +48,12 @@ class ChApi ChSolverAPGD : public ChIterativeSolverVI {
     void ShurBvectorCompute(ChSystemDescriptor& sysd);
     double Res4(ChSystemDescriptor& sysd);
 
+    /// Compute result = N * l, using either the descriptor or the compiled constraints.
+    void ShurComplementProduct(ChSystemDescriptor& sysd, ChVectorDynamic<>& result, const ChVectorDynamic<>& l);
+
+    /// Project the multipliers l, using either the descriptor or the compiled constraints.
+    void ConstraintsProject(ChSystemDescriptor& sysd, ChVectorDynamic<>& l);
+
     double residual;
     int nc;
     ChVectorDynamic<> gamma_hat, gammaNew, g, y, gamma, yNew, r, tmp;
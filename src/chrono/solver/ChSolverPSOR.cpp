@@ -23,6 +23,9 @@ CH_FACTORY_REGISTER(ChSolverPSOR)
 ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
+    if (m_use_compiled)
+        return SolveCompiled(sysd);
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -187,4 +190,133 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     return maxviolation;
 }
 
+double ChSolverPSOR::SolveCompiled(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    m_iterations = 0;
+    maxviolation = 0;
+    double maxdeltalambda = 0.;
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+    for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
+    }
+
+    // Pack constraints and variables in contiguous buffers
+    m_compiled.Build(sysd);
+    m_compiled.FromVariablesToQ(sysd);
+    ChVectorDynamic<>& l = m_compiled.L();
+    int nc = m_compiled.GetNumConstraints();
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+    for (int ic = 0; ic < nc; ic++) {
+        if (m_compiled.IsFriction(ic)) {
+            double average_g_i =
+                (m_compiled.Get_g_i(ic) + m_compiled.Get_g_i(ic + 1) + m_compiled.Get_g_i(ic + 2)) / 3.0;
+            m_compiled.Set_g_i(ic, average_g_i);
+            m_compiled.Set_g_i(ic + 1, average_g_i);
+            m_compiled.Set_g_i(ic + 2, average_g_i);
+            ic += 2;
+        }
+    }
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    if (m_warm_start) {
+        for (int ic = 0; ic < nc; ic++)
+            m_compiled.Increment_q(ic, l(ic));
+    } else {
+        l.setZero();
+    }
+
+    // 4)  Perform the iteration loops
+    //
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        maxviolation = 0;
+        maxdeltalambda = 0;
+
+        for (int ic = 0; ic < nc; ic++) {
+            if (m_compiled.IsFriction(ic)) {
+                // Frictional contact: update N,U,V, then project onto the friction cone
+                double old_lambda_friction[3];
+                for (int i = 0; i < 3; i++) {
+                    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+                    double mresidual = m_compiled.Compute_Cq_q(ic + i) + m_compiled.Get_b_i(ic + i) +
+                                       m_compiled.Get_cfm_i(ic + i) * l(ic + i);
+                    if (i == 0)
+                        maxviolation = ChMax(maxviolation, fabs(ChMin(0.0, mresidual)));
+
+                    // update:   lambda += delta_lambda;
+                    old_lambda_friction[i] = l(ic + i);
+                    l(ic + i) += (m_omega / m_compiled.Get_g_i(ic + i)) * (-mresidual);
+                }
+
+                m_compiled.Project(ic);  // the N normal component will take care of N,U,V
+
+                for (int i = 0; i < 3; i++) {
+                    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                    if (m_shlambda != 1.0)
+                        l(ic + i) = m_shlambda * l(ic + i) + (1.0 - m_shlambda) * old_lambda_friction[i];
+                    double true_delta = l(ic + i) - old_lambda_friction[i];
+                    m_compiled.Increment_q(ic + i, true_delta);
+
+                    if (this->record_violation_history)
+                        maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+                }
+
+                ic += 2;
+            } else {
+                // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+                double mresidual =
+                    m_compiled.Compute_Cq_q(ic) + m_compiled.Get_b_i(ic) + m_compiled.Get_cfm_i(ic) * l(ic);
+
+                // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+                maxviolation = ChMax(maxviolation, fabs(m_compiled.Violation(ic, mresidual)));
+
+                // update:   lambda += delta_lambda; then project onto the admissible set
+                double old_lambda = l(ic);
+                l(ic) += (m_omega / m_compiled.Get_g_i(ic)) * (-mresidual);
+                m_compiled.Project(ic);
+
+                // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                if (m_shlambda != 1.0)
+                    l(ic) = m_shlambda * l(ic) + (1.0 - m_shlambda) * old_lambda;
+
+                double true_delta = l(ic) - old_lambda;
+                m_compiled.Increment_q(ic, true_delta);
+
+                if (this->record_violation_history)
+                    maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+            }
+        }  // end loop on constraints
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+
+    }  // end iteration loop
+
+    // Copy results back to the constraints and variables
+    m_compiled.FromLToConstraints();
+    m_compiled.FromQToVariables(sysd);
+
+    return maxviolation;
+}
+
 }  // end namespace chrono
@@ -45,6 +45,9 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     virtual double GetError() const override { return maxviolation; }
 
   private:
+    /// Solve the problem using the compiled representation of the constraints.
+    double SolveCompiled(ChSystemDescriptor& sysd);
+
     double maxviolation;
 };
 
@@ -0,0 +1,329 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChSolverPSORcolored.h"
+#include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORcolored)
+
+// Colors with fewer blocks than this are processed serially (not worth the cost of a parallel region).
+static const int min_parallel_blocks = 64;
+
+ChSolverPSORcolored::ChSolverPSORcolored() : maxviolation(0), m_nthreads(ChOMP::GetNumProcs()), m_serial_color(-1) {}
+
+void ChSolverPSORcolored::SetNumThreads(int nthreads) {
+    m_nthreads = std::max(1, nthreads);
+}
+
+void ChSolverPSORcolored::ColorConstraints(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    // Index the active variables (this also ensures that their offsets are up to date)
+    int n_q = sysd.CountActiveVariables();
+    m_var_index.assign(n_q, -1);
+    int nv = 0;
+    for (auto var : mvariables) {
+        if (var->IsActive())
+            m_var_index[var->GetOffset()] = nv++;
+    }
+    m_var_colors.resize(nv);
+    for (auto& colors : m_var_colors)
+        colors.clear();
+
+    // Group active constraints in blocks. The three constraints of a frictional contact (N,U,V) are consecutive and
+    // must be processed together, since the projection onto the friction cone acts on all three.
+    m_block_start.clear();
+    m_block_size.clear();
+    int nc = (int)mconstraints.size();
+    for (int ic = 0; ic < nc;) {
+        if (!mconstraints[ic]->IsActive()) {
+            ic++;
+            continue;
+        }
+        int size = (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) ? 3 : 1;
+        assert(ic + size <= nc);
+        m_block_start.push_back(ic);
+        m_block_size.push_back(size);
+        ic += size;
+    }
+
+    // Greedy coloring: assign to each block the smallest color not already used by a block acting on one of its
+    // active variables. Inactive variables are not modified during the solution and hence do not create conflicts.
+    // Blocks with constraints that do not report their variables (see ChConstraint::AppendVariables) may conflict
+    // with any other block; they are collected in a last color, processed serially.
+    int nblocks = (int)m_block_start.size();
+    std::vector<int> block_color(nblocks);
+    std::vector<int> forbidden;  // forbidden[c] == b if color c is used by a neighbor of block b
+    std::vector<ChVariables*> vars;
+    std::vector<int> serial_blocks;
+    for (int b = 0; b < nblocks; b++) {
+        bool known_vars = true;
+        vars.clear();
+        for (int i = 0; i < m_block_size[b]; i++) {
+            size_t num_vars = vars.size();
+            mconstraints[m_block_start[b] + i]->AppendVariables(vars);
+            known_vars = known_vars && vars.size() > num_vars;
+        }
+        if (!known_vars) {
+            block_color[b] = -1;
+            serial_blocks.push_back(b);
+            continue;
+        }
+
+        for (auto var : vars) {
+            if (var && var->IsActive()) {
+                for (auto c : m_var_colors[m_var_index[var->GetOffset()]])
+                    forbidden[c] = b;
+            }
+        }
+
+        int color = 0;
+        while (color < (int)forbidden.size() && forbidden[color] == b)
+            color++;
+        if (color == (int)forbidden.size())
+            forbidden.push_back(-1);
+        block_color[b] = color;
+
+        for (auto var : vars) {
+            if (var && var->IsActive())
+                m_var_colors[m_var_index[var->GetOffset()]].push_back(color);
+        }
+    }
+
+    // Sort blocks by color (counting sort, preserving the original order within each color)
+    int ncolors = (int)forbidden.size();
+    m_serial_color = -1;
+    if (!serial_blocks.empty()) {
+        m_serial_color = ncolors++;
+        for (auto b : serial_blocks)
+            block_color[b] = m_serial_color;
+    }
+    m_color_start.assign(ncolors + 1, 0);
+    for (int b = 0; b < nblocks; b++)
+        m_color_start[block_color[b] + 1]++;
+    for (int c = 0; c < ncolors; c++)
+        m_color_start[c + 1] += m_color_start[c];
+    m_color_blocks.resize(nblocks);
+    std::vector<int> pos(m_color_start.begin(), m_color_start.end() - 1);
+    for (int b = 0; b < nblocks; b++)
+        m_color_blocks[pos[block_color[b]]++] = b;
+}
+
+void ChSolverPSORcolored::SolveBlock(ChConstraint** constraints,
+                                     int size,
+                                     double& max_violation,
+                                     double& max_deltalambda) const {
+    if (size == 3) {
+        // Frictional contact: update N,U,V, then project onto the friction cone (the N component takes care of all
+        // three) and propagate the projected increments to the variables.
+        double old_lambda[3];
+        double candidate_violation = 0;
+        for (int i = 0; i < 3; i++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = constraints[i]->Compute_Cq_q() + constraints[i]->Get_b_i() +
+                               constraints[i]->Get_cfm_i() * constraints[i]->Get_l_i();
+            if (i == 0)
+                candidate_violation = fabs(ChMin(0.0, mresidual));
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / constraints[i]->Get_g_i()) * (-mresidual);
+
+            // update:   lambda += delta_lambda;
+            old_lambda[i] = constraints[i]->Get_l_i();
+            constraints[i]->Set_l_i(old_lambda[i] + deltal);
+        }
+
+        constraints[0]->Project();
+
+        for (int i = 0; i < 3; i++) {
+            double new_lambda = constraints[i]->Get_l_i();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[i];
+                constraints[i]->Set_l_i(new_lambda);
+            }
+            double true_delta = new_lambda - old_lambda[i];
+            constraints[i]->Increment_q(true_delta);
+
+            if (record_violation_history)
+                max_deltalambda = ChMax(max_deltalambda, fabs(true_delta));
+        }
+
+        max_violation = ChMax(max_violation, candidate_violation);
+        return;
+    }
+
+    ChConstraint* constraint = constraints[0];
+
+    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+    double mresidual =
+        constraint->Compute_Cq_q() + constraint->Get_b_i() + constraint->Get_cfm_i() * constraint->Get_l_i();
+
+    // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+    double candidate_violation = fabs(constraint->Violation(mresidual));
+
+    // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+    double deltal = (m_omega / constraint->Get_g_i()) * (-mresidual);
+
+    // update:   lambda += delta_lambda;
+    double old_lambda = constraint->Get_l_i();
+    constraint->Set_l_i(old_lambda + deltal);
+
+    // If new lagrangian multiplier does not satisfy inequalities, project
+    // it into an admissible orthant (or, in general, onto an admissible set)
+    constraint->Project();
+
+    // After projection, the lambda may have changed a bit..
+    double new_lambda = constraint->Get_l_i();
+
+    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+    if (m_shlambda != 1.0) {
+        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+        constraint->Set_l_i(new_lambda);
+    }
+
+    double true_delta = new_lambda - old_lambda;
+
+    // For all items with variables, add the effect of incremented
+    // (and projected) lagrangian reactions:
+    constraint->Increment_q(true_delta);
+
+    if (record_violation_history)
+        max_deltalambda = ChMax(max_deltalambda, fabs(true_delta));
+
+    max_violation = ChMax(max_violation, candidate_violation);
+}
+
+double ChSolverPSORcolored::Solve(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    m_iterations = 0;
+    maxviolation = 0;
+    double maxdeltalambda = 0.;
+
+    int nc = (int)mconstraints.size();
+    int nv = (int)mvariables.size();
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+#pragma omp parallel for num_threads(m_nthreads)
+    for (int ic = 0; ic < nc; ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+    //
+    int j_friction_comp = 0;
+    double gi_values[3];
+    for (int ic = 0; ic < nc; ic++) {
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+            gi_values[j_friction_comp] = mconstraints[ic]->Get_g_i();
+            j_friction_comp++;
+            if (j_friction_comp == 3) {
+                double average_g_i = (gi_values[0] + gi_values[1] + gi_values[2]) / 3.0;
+                mconstraints[ic - 2]->Set_g_i(average_g_i);
+                mconstraints[ic - 1]->Set_g_i(average_g_i);
+                mconstraints[ic - 0]->Set_g_i(average_g_i);
+                j_friction_comp = 0;
+            }
+        }
+    }
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+#pragma omp parallel for num_threads(m_nthreads)
+    for (int iv = 0; iv < nv; iv++) {
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
+    }
+
+    // Color the constraint graph
+    ColorConstraints(sysd);
+    int ncolors = GetNumColors();
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    if (m_warm_start) {
+        for (int c = 0; c < ncolors; c++) {
+            int start = m_color_start[c];
+            int end = m_color_start[c + 1];
+            bool parallel = c != m_serial_color && end - start > min_parallel_blocks;
+#pragma omp parallel for num_threads(m_nthreads) if (parallel)
+            for (int k = start; k < end; k++) {
+                int b = m_color_blocks[k];
+                for (int i = 0; i < m_block_size[b]; i++) {
+                    ChConstraint* constraint = mconstraints[m_block_start[b] + i];
+                    constraint->Increment_q(constraint->Get_l_i());
+                }
+            }
+        }
+    } else {
+        for (int ic = 0; ic < nc; ic++)
+            mconstraints[ic]->Set_l_i(0.);
+    }
+
+    // 4)  Perform the iteration loops
+    //
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        maxviolation = 0;
+        maxdeltalambda = 0;
+
+        // Sweep the colors in sequence; blocks of the same color act on disjoint sets of variables and can be
+        // processed concurrently.
+        for (int c = 0; c < ncolors; c++) {
+            int start = m_color_start[c];
+            int end = m_color_start[c + 1];
+            bool parallel = c != m_serial_color && end - start > min_parallel_blocks;
+#pragma omp parallel num_threads(m_nthreads) if (parallel)
+            {
+                double t_maxviolation = 0;
+                double t_maxdeltalambda = 0;
+#pragma omp for
+                for (int k = start; k < end; k++) {
+                    int b = m_color_blocks[k];
+                    SolveBlock(&mconstraints[m_block_start[b]], m_block_size[b], t_maxviolation, t_maxdeltalambda);
+                }
+#pragma omp critical
+                {
+                    maxviolation = ChMax(maxviolation, t_maxviolation);
+                    maxdeltalambda = ChMax(maxdeltalambda, t_maxdeltalambda);
+                }
+            }
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+
+    }  // end iteration loop
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
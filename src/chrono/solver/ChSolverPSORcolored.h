@@ -0,0 +1,88 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_COLORED_H
+#define CHSOLVER_PSOR_COLORED_H
+
+#include <vector>
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// A parallel iterative solver based on projective fixed point method, with overrelaxation and immediate variable
+/// update as in SOR methods, where constraints are processed in parallel using a coloring of the constraint graph.\n
+/// Constraints are grouped in blocks (a single constraint, or the three constraints N,U,V of a frictional contact)
+/// and blocks are greedily colored such that no two blocks with the same color act on a common active variable.
+/// Colors are then swept in sequence and all blocks of a given color are processed in parallel. Since blocks of the
+/// same color are independent, this is equivalent to a PSOR sweep with a different ordering of the constraints (hence
+/// it preserves the Gauss-Seidel convergence properties of ChSolverPSOR), while using multiple threads.\n
+/// The coloring is recomputed at each call to Solve(), as the set of constraints typically changes at each step.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORcolored : public ChIterativeSolverVI {
+  public:
+    ChSolverPSORcolored();
+
+    ~ChSolverPSORcolored() {}
+
+    virtual Type GetType() const override { return Type::PSOR_COLORED; }
+
+    /// Set the number of OpenMP threads used during the solution (default: number of available processors).
+    /// Note that ChSystem::SetSolverType and ChSystem::SetNumThreads set this value to the number of Chrono threads.
+    void SetNumThreads(int nthreads);
+
+    /// Return the number of OpenMP threads used during the solution.
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Return the number of colors used in the last solve.
+    int GetNumColors() const { return (int)m_color_start.size() - 1; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PSOR solver, this is the maximum constraint violation.
+    virtual double GetError() const override { return maxviolation; }
+
+  private:
+    /// Group the active constraints in blocks and color the blocks.
+    void ColorConstraints(ChSystemDescriptor& sysd);
+
+    /// Perform one PSOR update for the block starting at the specified constraint.
+    void SolveBlock(ChConstraint** constraints, int size, double& max_violation, double& max_deltalambda) const;
+
+    double maxviolation;
+    int m_nthreads;
+
+    std::vector<int> m_block_start;   ///< index of the first constraint in each block
+    std::vector<int> m_block_size;    ///< number of constraints in each block (1, or 3 for frictional contacts)
+    std::vector<int> m_color_blocks;  ///< block indices, sorted by color
+    std::vector<int> m_color_start;   ///< start of each color in m_color_blocks (size: number of colors + 1)
+    int m_serial_color;               ///< color of the blocks with unknown variables (-1 if none)
+
+    std::vector<int> m_var_index;                ///< index of each active variable, by variable offset
+    std::vector<std::vector<int>> m_var_colors;  ///< colors of the blocks already acting on each active variable
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,199 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChSparseAssemblyMap.h"
+#include "chrono/solver/ChKblockGeneric.h"
+
+namespace chrono {
+
+void ChSparseAssemblyMap::Reset() {
+    m_valid = false;
+    m_signature.clear();
+}
+
+void ChSparseAssemblyMap::ComputeSignature(const std::vector<ChKblock*>& kblocks, std::vector<int>& signature) const {
+    signature.clear();
+    for (auto kblock : kblocks) {
+        auto kgen = dynamic_cast<ChKblockGeneric*>(kblock);
+        if (!kgen) {
+            signature.push_back(-2);
+            continue;
+        }
+        signature.push_back((int)kgen->GetNvars());
+        signature.push_back((int)kgen->Get_K().rows());
+        for (unsigned int iv = 0; iv < kgen->GetNvars(); iv++) {
+            auto var = kgen->GetVariableN(iv);
+            signature.push_back(var->IsActive() ? var->GetOffset() : -1);
+            signature.push_back(var->Get_ndof());
+        }
+    }
+}
+
+bool ChSparseAssemblyMap::Update(const std::vector<ChKblock*>& kblocks, const ChSparseMatrix& Z) {
+    if (!Z.isCompressed())
+        return false;
+
+    std::vector<int> signature;
+    ComputeSignature(kblocks, signature);
+
+    if (m_valid && m_rows == Z.rows() && m_nnz == Z.nonZeros() && signature == m_signature)
+        return true;
+
+    m_signature.swap(signature);
+    m_rows = (int)Z.rows();
+    m_nnz = (int)Z.nonZeros();
+    m_valid = Build(kblocks, Z);
+
+    return m_valid;
+}
+
+bool ChSparseAssemblyMap::Build(const std::vector<ChKblock*>& kblocks, const ChSparseMatrix& Z) {
+    const int* row_ptr = Z.outerIndexPtr();
+    const int* col = Z.innerIndexPtr();
+    int nblocks = (int)kblocks.size();
+
+    // Collect the CSR indices of all entries of the mapped blocks, traversing the blocks as in ChKblockGeneric::Build_K
+    m_block_start.assign(nblocks + 1, 0);
+    m_nz_index.clear();
+    m_serial_blocks.clear();
+    for (int ib = 0; ib < nblocks; ib++) {
+        m_block_start[ib] = (int)m_nz_index.size();
+        auto kgen = dynamic_cast<ChKblockGeneric*>(kblocks[ib]);
+        if (!kgen) {
+            m_serial_blocks.push_back(ib);
+            continue;
+        }
+        if (kgen->Get_K().rows() == 0)
+            continue;
+        for (unsigned int iv = 0; iv < kgen->GetNvars(); iv++) {
+            auto var_i = kgen->GetVariableN(iv);
+            if (!var_i->IsActive())
+                continue;
+            int io = var_i->GetOffset();
+            for (int r = 0; r < var_i->Get_ndof(); r++) {
+                const int* row_begin = col + row_ptr[io + r];
+                const int* row_end = col + row_ptr[io + r + 1];
+                for (unsigned int jv = 0; jv < kgen->GetNvars(); jv++) {
+                    auto var_j = kgen->GetVariableN(jv);
+                    if (!var_j->IsActive())
+                        continue;
+                    int jo = var_j->GetOffset();
+                    // columns jo...jo+jn-1 are consecutive in the (sorted) row, if all present
+                    const int* k = std::lower_bound(row_begin, row_end, jo);
+                    for (int c = 0; c < var_j->Get_ndof(); c++, k++) {
+                        if (k == row_end || *k != jo + c)
+                            return false;
+                        m_nz_index.push_back((int)(k - col));
+                    }
+                }
+            }
+        }
+    }
+    m_block_start[nblocks] = (int)m_nz_index.size();
+
+    // Greedy coloring of the mapped blocks: assign to each block the smallest color not already used by a block acting
+    // on one of its active variables (identified by their offset).
+    std::vector<std::vector<int>> var_colors(m_rows);
+    std::vector<int> block_color(nblocks, -1);
+    std::vector<int> forbidden;  // forbidden[c] == ib if color c is used by a neighbor of block ib
+    for (int ib = 0; ib < nblocks; ib++) {
+        auto kgen = dynamic_cast<ChKblockGeneric*>(kblocks[ib]);
+        if (!kgen)
+            continue;
+
+        for (unsigned int iv = 0; iv < kgen->GetNvars(); iv++) {
+            auto var = kgen->GetVariableN(iv);
+            if (var->IsActive()) {
+                for (auto c : var_colors[var->GetOffset()])
+                    forbidden[c] = ib;
+            }
+        }
+
+        int color = 0;
+        while (color < (int)forbidden.size() && forbidden[color] == ib)
+            color++;
+        if (color == (int)forbidden.size())
+            forbidden.push_back(-1);
+        block_color[ib] = color;
+
+        for (unsigned int iv = 0; iv < kgen->GetNvars(); iv++) {
+            auto var = kgen->GetVariableN(iv);
+            if (var->IsActive())
+                var_colors[var->GetOffset()].push_back(color);
+        }
+    }
+
+    // Sort mapped blocks by color (counting sort, preserving the original order within each color)
+    int ncolors = (int)forbidden.size();
+    m_color_start.assign(ncolors + 1, 0);
+    for (int ib = 0; ib < nblocks; ib++) {
+        if (block_color[ib] >= 0)
+            m_color_start[block_color[ib] + 1]++;
+    }
+    for (int c = 0; c < ncolors; c++)
+        m_color_start[c + 1] += m_color_start[c];
+    m_color_blocks.resize(m_color_start[ncolors]);
+    std::vector<int> pos(m_color_start.begin(), m_color_start.end() - 1);
+    for (int ib = 0; ib < nblocks; ib++) {
+        if (block_color[ib] >= 0)
+            m_color_blocks[pos[block_color[ib]]++] = ib;
+    }
+
+    return true;
+}
+
+void ChSparseAssemblyMap::LoadKblocks(const std::vector<ChKblock*>& kblocks, ChSparseMatrix& Z, int nthreads) const {
+    assert(m_valid);
+    double* values = Z.valuePtr();
+
+    for (int ic = 0; ic < GetNumColors(); ic++) {
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int k = m_color_start[ic]; k < m_color_start[ic + 1]; k++) {
+            int ib = m_color_blocks[k];
+            auto kgen = static_cast<ChKblockGeneric*>(kblocks[ib]);
+            ChMatrixRef K = kgen->Get_K();
+            if (K.rows() == 0)
+                continue;
+            const int* nz = m_nz_index.data() + m_block_start[ib];
+            int kio = 0;
+            for (unsigned int iv = 0; iv < kgen->GetNvars(); iv++) {
+                auto var_i = kgen->GetVariableN(iv);
+                int in = var_i->Get_ndof();
+                if (var_i->IsActive()) {
+                    for (int r = 0; r < in; r++) {
+                        int kjo = 0;
+                        for (unsigned int jv = 0; jv < kgen->GetNvars(); jv++) {
+                            auto var_j = kgen->GetVariableN(jv);
+                            int jn = var_j->Get_ndof();
+                            if (var_j->IsActive()) {
+                                for (int c = 0; c < jn; c++)
+                                    values[*nz++] += K(kio + r, kjo + c);
+                            }
+                            kjo += jn;
+                        }
+                    }
+                }
+                kio += in;
+            }
+        }
+    }
+
+    // Blocks not in the map
+    for (auto ib : m_serial_blocks)
+        kblocks[ib]->Build_K(Z, true);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,79 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#ifndef CH_SPARSE_ASSEMBLY_MAP_H
+#define CH_SPARSE_ASSEMBLY_MAP_H
+
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
+#include "chrono/solver/ChKblock.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Scatter map for the parallel assembly of stiffness blocks (ChKblock) into a sparse matrix with fixed sparsity
+/// pattern.\n
+/// For each entry of each block, the map stores the index of the corresponding nonzero in the compressed (CSR) storage
+/// of the system matrix, so that the block values can be added without searching for, or inserting, matrix entries.
+/// Blocks are also colored such that no two blocks with the same color refer to a common active variable; blocks of a
+/// given color write to disjoint matrix entries and are loaded in parallel. As such, results do not depend on the
+/// number of threads.\n
+/// The map is rebuilt automatically if the blocks, their variables, or the size of the matrix change; call Reset()
+/// whenever the sparsity pattern of the matrix changes otherwise (e.g., after a call to the sparsity pattern learner).
+/// Only blocks of type ChKblockGeneric are mapped; any other block is loaded serially through its Build_K function.
+class ChApi ChSparseAssemblyMap {
+  public:
+    ChSparseAssemblyMap() : m_valid(false), m_rows(0), m_nnz(0) {}
+
+    /// Invalidate the map, forcing a rebuild at the next call to Update().
+    void Reset();
+
+    /// Make sure the map is up to date for the given blocks and for the sparsity pattern of the given matrix.
+    /// Return false if the map cannot be used, i.e. if the matrix is not in compressed form or if its sparsity pattern
+    /// does not include all entries of the blocks.
+    bool Update(const std::vector<ChKblock*>& kblocks, const ChSparseMatrix& Z);
+
+    /// Add the values of all blocks into the matrix, i.e. Z += K, using the specified number of threads.
+    /// Update() must have been called, with the same blocks and matrix pattern, and must have returned true.
+    void LoadKblocks(const std::vector<ChKblock*>& kblocks, ChSparseMatrix& Z, int nthreads) const;
+
+    /// Return the number of colors in the current map.
+    int GetNumColors() const { return m_color_start.empty() ? 0 : (int)m_color_start.size() - 1; }
+
+  private:
+    /// Encode the structure of the blocks (variable offsets and sizes), used to detect changes.
+    void ComputeSignature(const std::vector<ChKblock*>& kblocks, std::vector<int>& signature) const;
+
+    /// Rebuild the map. Return false if an entry is missing from the sparsity pattern of Z.
+    bool Build(const std::vector<ChKblock*>& kblocks, const ChSparseMatrix& Z);
+
+    bool m_valid;                     ///< map successfully built
+    int m_rows;                       ///< number of rows of the matrix when the map was built
+    int m_nnz;                        ///< number of nonzeros of the matrix when the map was built
+    std::vector<int> m_signature;     ///< structure of the blocks when the map was built
+    std::vector<int> m_block_start;   ///< start of each block in m_nz_index (size: number of blocks + 1)
+    std::vector<int> m_nz_index;      ///< index in the CSR storage of each entry of each block
+    std::vector<int> m_color_blocks;  ///< mapped block indices, sorted by color
+    std::vector<int> m_color_start;   ///< start of each color in m_color_blocks (size: number of colors + 1)
+    std::vector<int> m_serial_blocks; ///< indices of blocks which are not mapped
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -270,6 +270,61 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
     }
 }
 
+bool ChSystemDescriptor::ConvertToMatrixFormParallel(ChSparseMatrix& Z, ChSparseAssemblyMap& kmap, int nthreads) {
+    std::vector<ChConstraint*>& mconstraints = GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = GetVariablesList();
+
+    auto mv_size = mvariables.size();
+    auto mc_size = mconstraints.size();
+
+    // Count constraints.
+    int mn_c = 0;
+    for (size_t ic = 0; ic < mc_size; ic++) {
+        if (mconstraints[ic]->IsActive())
+            mn_c++;
+    }
+
+    // Count active variables, by scanning through all variable blocks, and set offsets.
+    n_q = CountActiveVariables();
+
+    // The existing matrix pattern must match the problem and include all entries of the K blocks.
+    if (Z.rows() != n_q + mn_c || Z.cols() != n_q + mn_c)
+        return false;
+    if (!kmap.Update(vstiffness, Z))
+        return false;
+
+    Z.setZeroValues();
+
+    // Fill Z with masses and inertias.
+    int s_q = 0;
+    for (size_t iv = 0; iv < mv_size; iv++) {
+        if (mvariables[iv]->IsActive()) {
+            // Masses and inertias in upper-left block of Z
+            mvariables[iv]->Build_M(Z, s_q, s_q, c_a);
+            s_q += mvariables[iv]->Get_ndof();
+        }
+    }
+
+    // Add stiffness matrix K to upper-left block of Z, in parallel.
+    kmap.LoadKblocks(vstiffness, Z, nthreads);
+
+    // Fill Z by looping over constraints.
+    int s_c = 0;
+    for (size_t ic = 0; ic < mc_size; ic++) {
+        if (mconstraints[ic]->IsActive()) {
+            // Constraint Jacobian in lower-left block of Z
+            mconstraints[ic]->Build_Cq(Z, n_q + s_c);
+            // Transposed constraint Jacobian in upper-right block of Z
+            mconstraints[ic]->Build_CqT(Z, n_q + s_c);
+            // E ( = cfm ) in lower-right block of Z
+            Z.SetElement(n_q + s_c, n_q + s_c, mconstraints[ic]->Get_cfm_i());
+            s_c++;
+        }
+    }
+
+    return true;
+}
+
 int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector) {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
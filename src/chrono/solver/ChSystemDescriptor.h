@@ -19,6 +19,7 @@
 
 #include "chrono/solver/ChConstraint.h"
 #include "chrono/solver/ChKblock.h"
+#include "chrono/solver/ChSparseAssemblyMap.h"
 #include "chrono/solver/ChVariables.h"
 
 namespace chrono {
@@ -325,6 +326,15 @@ class ChApi ChSystemDescriptor {
                                      ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     );
 
+    /// Assemble the system matrix as in ConvertToMatrixForm(Z, nullptr), into the existing sparsity pattern of Z, with
+    /// the stiffness blocks loaded in parallel through the provided scatter map (see ChSparseAssemblyMap).
+    /// Return false, without modifying Z, if the matrix size does not match the problem size or if the sparsity pattern
+    /// of Z does not include all entries of the stiffness blocks. In that case, use ConvertToMatrixForm instead.
+    virtual bool ConvertToMatrixFormParallel(ChSparseMatrix& Z,          ///< [in/out] assembled system matrix
+                                             ChSparseAssemblyMap& kmap,  ///< [in/out] scatter map for K blocks
+                                             int nthreads                ///< number of OpenMP threads
+    );
+
     /// Write the current assembled system matrix and right-hand side vector.
     /// The system matrix is formed by calling ConvertToMatrixForm() as used with direct linear solvers.
     /// The following files are written in the directory specified by [path]:
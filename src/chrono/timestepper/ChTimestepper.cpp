@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
@@ -301,6 +302,50 @@ void ChTimestepperLeapfrog::Advance(const double dt) {
 
 // -----------------------------------------------------------------------------
 
+void ChImplicitIterativeTimestepper::JacobianStepInit(double dt, int n) {
+    jac_norm = -1;
+
+    // With automatic updates, reuse the Newton matrix from a previous step only if it still corresponds to the
+    // current problem (same size, same step size) and if the previous step converged.
+    jac_call_setup = (jacobian_update != JacobianUpdate::AUTOMATIC) || !jac_current || n != jac_size || dt != jac_step;
+
+    jac_size = n;
+    jac_step = dt;
+}
+
+bool ChImplicitIterativeTimestepper::JacobianCallSetup(const ChVectorDynamic<>& R, const ChVectorDynamic<>& Qc) {
+    double norm = std::max(R.lpNorm<Eigen::Infinity>() / abstolS, Qc.lpNorm<Eigen::Infinity>() / abstolL);
+
+    switch (jacobian_update) {
+        case JacobianUpdate::EVERY_ITERATION:
+            jac_call_setup = true;
+            break;
+        case JacobianUpdate::EVERY_STEP:
+            break;
+        case JacobianUpdate::AUTOMATIC:
+            // refresh the Newton matrix if convergence is too slow with the current one
+            if (jac_norm > 0 && norm > jacobian_update_rate * jac_norm)
+                jac_call_setup = true;
+            break;
+    }
+
+    jac_norm = norm;
+    return jac_call_setup;
+}
+
+void ChImplicitIterativeTimestepper::JacobianIterationDone(bool setup) {
+    if (setup)
+        jac_current = true;
+    jac_call_setup = false;
+}
+
+void ChImplicitIterativeTimestepper::JacobianStepDone(bool converged) {
+    if (!converged)
+        jac_current = false;
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 
@@ -336,6 +381,8 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
+    bool converged = false;
+    JacobianStepInit(dt, mintegrable->GetNcoords_v() + mintegrable->GetNconstr());
 
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -350,8 +397,12 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             GetLog() << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                      << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << "\n";
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        bool call_setup = JacobianCallSetup(R, Qc);
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -361,12 +412,15 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+        }
+        JacobianIterationDone(call_setup);
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -376,6 +430,8 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         Xnew = X + Vnew * dt;
     }
 
+    JacobianStepDone(converged);
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -598,6 +654,8 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
+    bool converged = false;
+    JacobianStepInit(dt, mintegrable->GetNcoords_v() + mintegrable->GetNconstr());
 
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -612,8 +670,12 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             GetLog() << " Trapezoidal iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                      << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << "\n";
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        bool call_setup = JacobianCallSetup(R, Qc);
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -623,12 +685,15 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always force a call to the solver's Setup() function
+            call_setup                      // force a call to the solver's Setup() function?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+        }
+        JacobianIterationDone(call_setup);
 
         Dl *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -638,6 +703,8 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
         Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
     }
 
+    JacobianStepDone(converged);
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -698,6 +765,10 @@ void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
     // mintegrable->LoadResidual_CqL(R, L, dt*0.5); // + dt/2*Cq*l_new  assume l_old = 0;
     mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp, Qc_clamping);  // -C/dt
 
+    // Single Newton iteration: the Newton matrix is updated at each step, unless reused with JacobianUpdate::AUTOMATIC
+    JacobianStepInit(dt, mintegrable->GetNcoords_v() + mintegrable->GetNconstr());
+    bool call_setup = JacobianCallSetup(R, Qc);
+
     mintegrable->StateSolveCorrection(  //
         Dv, Dl, R, Qc,                  //
         1.0,                            // factor for  M
@@ -706,12 +777,14 @@ void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
         Xnew, Vnew, T + dt,             // not used here (scatter = false)
         false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
         false,                          // full update? (not used, since no scatter)
-        true                            // force a call to the solver's Setup() function
+        call_setup                      // call the solver's Setup?
     );
 
     numiters = 1;
-    numsetups = 1;
+    numsetups = call_setup ? 1 : 0;
     numsolves = 1;
+    JacobianIterationDone(call_setup);
+    JacobianStepDone(true);
 
     Dl *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
     L += Dl;
@@ -771,6 +844,10 @@ void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
     mintegrable->LoadResidual_F(R, dt * 0.5);                               // + dt/2*f_new
     mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp, Qc_clamping);  // -C/dt
 
+    // Single Newton iteration: the Newton matrix is updated at each step, unless reused with JacobianUpdate::AUTOMATIC
+    JacobianStepInit(dt, mintegrable->GetNcoords_v() + mintegrable->GetNconstr());
+    bool call_setup = JacobianCallSetup(R, Qc);
+
     mintegrable->StateSolveCorrection(  //
         Vnew, L, R, Qc,                 //
         1.0,                            // factor for  M
@@ -779,12 +856,14 @@ void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
         Xnew, Vnew, T + dt,             // not used here (scatter = false)
         false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
         false,                          // full update? (not used, since no scatter)
-        true                            // force a call to the solver's Setup() function
+        call_setup                      // call the solver's Setup?
     );
 
     numiters = 1;
-    numsetups = 1;
+    numsetups = call_setup ? 1 : 0;
     numsolves = 1;
+    JacobianIterationDone(call_setup);
+    JacobianStepDone(true);
 
     L *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
@@ -856,7 +935,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
-    bool call_setup = true;
+    bool converged = false;
+    JacobianStepInit(dt, mintegrable->GetNcoords_a() + mintegrable->GetNconstr());
 
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -876,10 +956,13 @@ void ChTimestepperNewmark::Advance(const double dt) {
             if (verbose) {
                 GetLog() << " Newmark NR converged (" << i << ")." << "  T = " << T + dt << "  h = " << dt << "\n";
             }
+            converged = true;
             break;
         }
 
-        if (verbose && modified_Newton && call_setup)
+        bool call_setup = JacobianCallSetup(R, Qc);
+
+        if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
                 GetLog() << " Newmark call Setup.\n";
 
         mintegrable->StateSolveCorrection(  //
@@ -898,9 +981,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
         if (call_setup) {
             numsetups++;
         }
-
-        // If using modified Newton, do not call Setup again
-        call_setup = !modified_Newton;
+        JacobianIterationDone(call_setup);
 
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
@@ -910,6 +991,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
         Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
     }
 
+    JacobianStepDone(converged);
+
     X = Xnew;
     V = Vnew;
     A = Anew;
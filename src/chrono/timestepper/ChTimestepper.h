@@ -187,8 +187,28 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     int numsolves;  ///< number of calls to the solver's Solve function
 
   public:
+    /// Methods for updating the Newton matrix (and its factorization, for direct solvers).
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< full Newton: call the solver's Setup at each iteration
+        EVERY_STEP,       ///< modified Newton: call the solver's Setup only at the first iteration of each step
+        AUTOMATIC         ///< reuse the Newton matrix across iterations and steps, until convergence degrades
+    };
+
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          jacobian_update(JacobianUpdate::EVERY_ITERATION),
+          jacobian_update_rate(0.5),
+          jac_call_setup(true),
+          jac_current(false),
+          jac_size(0),
+          jac_step(0),
+          jac_norm(-1) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -228,6 +248,29 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     int GetNumSolveCalls() const { return numsolves; }
 
+    /// Set the method for updating the Newton matrix (default: JacobianUpdate::EVERY_ITERATION).
+    /// With JacobianUpdate::AUTOMATIC, the solver's Setup function (i.e., matrix assembly and factorization, for a
+    /// direct solver) is called only when needed: at the first step, when the problem size or the step size change,
+    /// after a step which did not converge, and whenever the residual norm decreases by less than the specified rate
+    /// (see SetJacobianUpdateRate) between two successive iterations. This is only effective with solvers which keep
+    /// their factorization between calls to Solve (e.g., ChDirectSolverLS).
+    /// For the linearized timesteppers, which perform a single iteration per step, EVERY_ITERATION and EVERY_STEP are
+    /// equivalent, and AUTOMATIC reuses the Newton matrix as long as the problem size and the step size do not change.
+    void SetJacobianUpdateMethod(JacobianUpdate method) { jacobian_update = method; }
+
+    /// Return the current method for updating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update; }
+
+    /// Set the convergence rate threshold for JacobianUpdate::AUTOMATIC (default: 0.5).
+    /// The Newton matrix is updated if the ratio of the (scaled) residual norms at two successive iterations exceeds
+    /// this value.
+    void SetJacobianUpdateRate(double rate) { jacobian_update_rate = rate; }
+
+    /// Force an update of the Newton matrix at the next iteration.
+    /// This must be called if the solver was set up for a different problem between two steps; the owner ChSystem does
+    /// so automatically after assembly and static analyses.
+    void ForceJacobianUpdate() { jac_current = false; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& archive) {
         // version number
@@ -249,6 +292,31 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
         archive >> CHNVP(abstolS);
         archive >> CHNVP(abstolL);
     }
+
+  protected:
+    /// Initialize the Newton matrix update policy at the beginning of a step of size dt, for a problem with n unknowns.
+    void JacobianStepInit(double dt, int n);
+
+    /// Return true if the solver's Setup function must be called at the current Newton iteration, given the current
+    /// residuals R and Qc (scaled with the absolute tolerances abstolS and abstolL, respectively).
+    bool JacobianCallSetup(const ChVectorDynamic<>& R, const ChVectorDynamic<>& Qc);
+
+    /// Record the completion of a Newton iteration, with or without a call to the solver's Setup function.
+    void JacobianIterationDone(bool setup);
+
+    /// Record the end of a step.
+    /// If the Newton iterations did not converge, the Newton matrix is updated at the next step.
+    void JacobianStepDone(bool converged);
+
+    JacobianUpdate jacobian_update;  ///< method for updating the Newton matrix
+    double jacobian_update_rate;     ///< convergence rate threshold for Newton matrix updates (AUTOMATIC)
+
+  private:
+    bool jac_call_setup;  ///< call the solver's Setup at the current iteration?
+    bool jac_current;     ///< is the solver's Newton matrix usable for the next step?
+    int jac_size;         ///< problem size at the last call to Setup
+    double jac_step;      ///< step size at the last call to Setup
+    double jac_norm;      ///< scaled residual norm at the previous iteration
 };
 
 /// Euler explicit timestepper.
@@ -509,14 +577,14 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     ChVectorDynamic<> R;
     ChVectorDynamic<> Rold;
     ChVectorDynamic<> Qc;
-    bool modified_Newton;
 
   public:
     /// Constructors (default empty)
     ChTimestepperNewmark(ChIntegrableIIorder* intgr = nullptr)
         : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {
         SetGammaBeta(0.6, 0.3);  // default values with some damping, and that works also with DAE constraints
-        modified_Newton = true; // default use modified Newton with jacobian factorization only at beginning
+        // default use modified Newton with jacobian factorization only at beginning
+        jacobian_update = JacobianUpdate::EVERY_STEP;
     }
 
     virtual Type GetType() const override { return Type::NEWMARK; }
@@ -539,7 +607,11 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once per step.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Modified Newton iteration is enabled by default.
-    void SetModifiedNewton(bool val) { modified_Newton = val; }
+    /// This is equivalent to SetJacobianUpdateMethod with JacobianUpdate::EVERY_STEP (enabled) or
+    /// JacobianUpdate::EVERY_ITERATION (disabled).
+    void SetModifiedNewton(bool val) {
+        jacobian_update = val ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION;
+    }
 
     /// Performs an integration timestep
     virtual void Advance(const double dt  ///< timestep to advance
@@ -33,9 +33,10 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       step_decrease_factor(0.5),
       h_min(1e-10),
       h(1e6),
-      num_successful_steps(0),
-      modified_Newton(true) {
+      num_successful_steps(0) {
     SetAlpha(-0.2);  // default: some dissipation
+    // default: modified Newton
+    jacobian_update = JacobianUpdate::EVERY_STEP;
 }
 
 void ChTimestepperHHT::SetAlpha(double malpha) {
@@ -101,40 +102,37 @@ void ChTimestepperHHT::Advance(const double dt) {
         h = ChMin(h, dt);
     }
 
-    // Monitor flags controlling whther or not the Newton matrix must be updated.
+    // Monitor flags controlling whther or not the Newton matrix must be updated (see SetJacobianUpdateMethod).
     // If using modified Newton, a matrix update occurs:
-    //   - at the beginning of a step
-    //   - on a stepsize decrease
+    //   - at the beginning of each (internal) step, including after a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
     matrix_is_current = false;
-    call_setup = true;
 
     // Loop until reaching final time
     while (true) {
         double scaling_factor = scaling ? beta * h * h : 1;
         Prepare(mintegrable, scaling_factor);
+        JacobianStepInit(h, mintegrable->GetNcoords_a() + mintegrable->GetNconstr());
 
         // Newton-Raphson for state at T+h
         bool converged = false;
         int it;
 
         for (it = 0; it < maxiters; it++) {
-            if (verbose && modified_Newton && call_setup)
-                GetLog() << " HHT call Setup.\n";
-
             // Solve linear system and increment state
             Increment(mintegrable, scaling_factor);
 
+            if (verbose && call_setup)
+                GetLog() << " HHT call Setup.\n";
+
             // Increment counters
             numiters++;
             numsolves++;
             if (call_setup) {
                 numsetups++;
             }
-
-            // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
+            JacobianIterationDone(call_setup);
 
             // A flag to indicate the trend of convergence
             if ((Rold.norm() < R.norm()) && (R.norm() > threshold_R)) {
@@ -154,6 +152,7 @@ void ChTimestepperHHT::Advance(const double dt) {
             convergence_trend_flag = false;
         }
 
+        JacobianStepDone(converged);
 
         if (converged) {
             // ------ NR converged
@@ -234,8 +233,7 @@ void ChTimestepperHHT::Advance(const double dt) {
                 throw ChException("HHT: Reached minimum allowable step size.");
             }
 
-            // force a matrix re-evaluation (due to change in stepsize)
-            call_setup = true;
+            // a matrix re-evaluation is forced by the change in stepsize (see JacobianStepInit)
         }
 
         if (T >= tfinal) {
@@ -320,7 +318,8 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable, double scaling
             integrable->LoadResidual_Mv(R, Anew, -1 / (1 + alpha));                          // -1/(1+alpha)*M*a_new
             integrable->LoadConstraint_C(Qc, 1 / (beta * h * h), Qc_do_clamp, Qc_clamping);  //  1/(beta*dt^2)*C
 
-            // Solve linear system
+            // Solve linear system (update the Newton matrix if needed)
+            call_setup = JacobianCallSetup(R, Qc);
             integrable->StateSolveCorrection(Da, Dl, R, Qc,
                                              1 / (1 + alpha),    // factor for  M (was 1 in Negrut paper ?!)
                                              -h * gamma,         // factor for  dF/dv
@@ -346,7 +345,8 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable, double scaling
             integrable->LoadResidual_Mv(R, Anew, -1 / (1 + alpha) * scaling_factor);  // -1/(1+alpha)*M*a_new
             integrable->LoadConstraint_C(Qc, 1.0, Qc_do_clamp, Qc_clamping);          //  1/(beta*dt^2)*C
 
-            // Solve linear system
+            // Solve linear system (update the Newton matrix if needed)
+            call_setup = JacobianCallSetup(R, Qc);
             integrable->StateSolveCorrection(Da, Dl, R, Qc,
                                              scaling_factor / ((1 + alpha) * beta * h * h),  // factor for  M
                                              -scaling_factor * gamma / (beta * h),           // factor for  dF/dv
@@ -61,7 +61,6 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double h;                     ///< internal stepsize
     int num_successful_steps;     ///< number of successful steps
 
-    bool modified_Newton;    ///< use modified Newton?
     bool matrix_is_current;  ///< is the Newton matrix up-to-date?
     bool call_setup;         ///< should the solver's Setup function be called?
 
@@ -119,7 +118,13 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// per step or if the Newton iteration does not converge with an out-of-date matrix.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Modified Newton iteration is enabled by default.
-    void SetModifiedNewton(bool val) { modified_Newton = val; }
+    /// This is equivalent to SetJacobianUpdateMethod with JacobianUpdate::EVERY_STEP (enabled) or
+    /// JacobianUpdate::EVERY_ITERATION (disabled).
+    /// Note that, with step size control, each internal step (including a step re-attempted with a smaller step size)
+    /// counts as a step for the Newton matrix update.
+    void SetModifiedNewton(bool val) {
+        jacobian_update = val ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION;
+    }
 
     /// Perform an integration timestep.
     virtual void Advance(const double dt  ///< timestep to advance
@@ -514,7 +514,6 @@ void ChCollisionSystemDistributed::Remove(ChCollisionModel* model) {
 }
 
 void ChCollisionSystemDistributed::GetOverlappingAABB(custom_vector<char>& active_id, real3 Amin, real3 Amax) {
-    GenerateAABB();
     ////#pragma omp parallel for
     for (int i = 0; i < ddm->data_manager->cd_data->shape_data.typ_rigid.size(); i++) {
         auto id_rigid = ddm->data_manager->cd_data->shape_data.id_rigid[i];
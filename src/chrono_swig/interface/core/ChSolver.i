@@ -13,6 +13,7 @@
 %csmethodmodifiers chrono::ChSolverBB::Solve "public"
 %csmethodmodifiers chrono::ChSolverPJacobi::Solve "public"
 %csmethodmodifiers chrono::ChSolverPSOR::Solve "public"
+%csmethodmodifiers chrono::ChSolverPSORcolored::Solve "public"
 %csmethodmodifiers chrono::ChSolverBiCGSTAB::Solve "public"
 %csmethodmodifiers chrono::ChSolverGMRES::Solve "public"
 %csmethodmodifiers chrono::ChSolverMINRES::Solve "public"
@@ -22,6 +23,7 @@
 %csmethodmodifiers chrono::ChSolverBB::GetType "public"
 %csmethodmodifiers chrono::ChSolverPJacobi::GetType "public"
 %csmethodmodifiers chrono::ChSolverPSOR::GetType "public"
+%csmethodmodifiers chrono::ChSolverPSORcolored::GetType "public"
 %csmethodmodifiers chrono::ChSolverBiCGSTAB::GetType "public"
 %csmethodmodifiers chrono::ChSolverGMRES::GetType "public"
 %csmethodmodifiers chrono::ChSolverMINRES::GetType "public"
@@ -31,6 +33,7 @@
 %csmethodmodifiers chrono::ChSolverBB::GetError "public"
 %csmethodmodifiers chrono::ChSolverPJacobi::GetError "public"
 %csmethodmodifiers chrono::ChSolverPSOR::GetError "public"
+%csmethodmodifiers chrono::ChSolverPSORcolored::GetError "public"
 %csmethodmodifiers chrono::ChSolverBiCGSTAB::GetError "public"
 %csmethodmodifiers chrono::ChSolverGMRES::GetError "public"
 %csmethodmodifiers chrono::ChSolverMINRES::GetError "public"
@@ -45,6 +48,7 @@
 %csmethodmodifiers chrono::ChSolverBB::ArchiveIN "public"
 %csmethodmodifiers chrono::ChSolverPJacobi::ArchiveIN "public"
 %csmethodmodifiers chrono::ChSolverPSOR::ArchiveIN "public"
+%csmethodmodifiers chrono::ChSolverPSORcolored::ArchiveIN "public"
 %csmethodmodifiers chrono::ChSolverBiCGSTAB::ArchiveIN "public"
 %csmethodmodifiers chrono::ChSolverGMRES::ArchiveIN "public"
 %csmethodmodifiers chrono::ChSolverMINRES::ArchiveIN "public"
@@ -54,6 +58,7 @@
 %csmethodmodifiers chrono::ChSolverBB::ArchiveOUT "public"
 %csmethodmodifiers chrono::ChSolverPJacobi::ArchiveOUT "public"
 %csmethodmodifiers chrono::ChSolverPSOR::ArchiveOUT "public"
+%csmethodmodifiers chrono::ChSolverPSORcolored::ArchiveOUT "public"
 %csmethodmodifiers chrono::ChSolverBiCGSTAB::ArchiveOUT "public"
 %csmethodmodifiers chrono::ChSolverGMRES::ArchiveOUT "public"
 %csmethodmodifiers chrono::ChSolverMINRES::ArchiveOUT "public"
@@ -76,6 +81,7 @@
 #include "chrono/solver/ChSolverBB.h"
 #include "chrono/solver/ChSolverAPGD.h"
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
 #include "chrono/solver/ChSolverPJacobi.h"
 #include "chrono/solver/ChSolverADMM.h"
 
@@ -96,6 +102,7 @@ using namespace chrono;
 %shared_ptr(chrono::ChSolverBB)
 %shared_ptr(chrono::ChSolverAPGD)
 %shared_ptr(chrono::ChSolverPSOR)
+%shared_ptr(chrono::ChSolverPSORcolored)
 %shared_ptr(chrono::ChSolverPJacobi)
 %shared_ptr(chrono::ChSolverSparseLU)
 %shared_ptr(chrono::ChSolverSparseQR)
@@ -113,5 +120,6 @@ using namespace chrono;
 %include "../../../chrono/solver/ChSolverBB.h"
 %include "../../../chrono/solver/ChSolverAPGD.h"
 %include "../../../chrono/solver/ChSolverPSOR.h"
+%include "../../../chrono/solver/ChSolverPSORcolored.h"
 %include "../../../chrono/solver/ChSolverPJacobi.h"
 %include "../../../chrono/solver/ChSolverADMM.h"
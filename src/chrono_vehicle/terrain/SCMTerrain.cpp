@@ -18,6 +18,7 @@
 // =============================================================================
 
 #include <cstdio>
+#include <cstdint>
 #include <cmath>
 #include <queue>
 #include <unordered_set>
@@ -127,6 +128,18 @@ void SCMTerrain::WriteMesh(const std::string& filename) const {
     trimesh->WriteWavefront(filename, meshes);
 }
 
+// Enable output of the terrain changes at each step.
+void SCMTerrain::SetDeltaOutput(const std::string& filename) {
+    if (m_loader->m_delta_stream.is_open())
+        m_loader->m_delta_stream.close();
+    m_loader->m_delta_header = false;
+    if (filename.empty())
+        return;
+    m_loader->m_delta_stream.open(filename, std::ios::binary);
+    if (!m_loader->m_delta_stream.is_open())
+        std::cout << "SCMTerrain::SetDeltaOutput  -- cannot open file " << filename << std::endl;
+}
+
 // Set properties of the SCM soil model.
 void SCMTerrain::SetSoilParameters(
     double Bekker_Kphi,    // Kphi, frictional modulus in Bekker model
@@ -196,6 +209,18 @@ void SCMTerrain::AddMovingPatch(std::shared_ptr<ChBody> body,
     m_loader->m_moving_patch = true;
 }
 
+// Enable ray casting against the moving patch bodies only.
+void SCMTerrain::EnablePatchRayCasting(bool val) {
+    m_loader->m_patch_ray_casting = val;
+}
+
+// Enable the multiresolution mode.
+void SCMTerrain::EnableMultiresolution(bool val, int coarsening_factor, double coarsening_distance) {
+    m_loader->m_multires = val;
+    m_loader->m_coarsening_factor = std::max(coarsening_factor, 2);
+    m_loader->m_coarsening_distance = coarsening_distance;
+}
+
 // Set user-supplied callback for evaluating location-dependent soil parameters.
 void SCMTerrain::RegisterSoilParametersCallback(std::shared_ptr<SoilParametersCallback> cb) {
     m_loader->m_soil_fun = cb;
@@ -264,6 +289,11 @@ int SCMTerrain::GetNumErosionNodes() const {
     return m_loader->m_num_erosion_nodes;
 }
 
+// Return the number of grid nodes coarsened at last step (multiresolution mode).
+int SCMTerrain::GetNumCoarsenedNodes() const {
+    return m_loader->m_num_coarsened_nodes;
+}
+
 // Timer information
 double SCMTerrain::GetTimerMovingPatches() const {
     return 1e3 * m_loader->m_timer_moving_patches();
@@ -283,6 +313,9 @@ double SCMTerrain::GetTimerContactForces() const {
 double SCMTerrain::GetTimerBulldozing() const {
     return 1e3 * m_loader->m_timer_bulldozing();
 }
+double SCMTerrain::GetTimerCoarsening() const {
+    return 1e3 * m_loader->m_timer_coarsening();
+}
 double SCMTerrain::GetTimerVisUpdate() const {
     return 1e3 * m_loader->m_timer_visualization();
 }
@@ -299,6 +332,7 @@ void SCMTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "      Raise boundary:       " << 1e3 * m_loader->m_timer_bulldozing_boundary() << std::endl;
     os << "      Compute domain:       " << 1e3 * m_loader->m_timer_bulldozing_domain() << std::endl;
     os << "      Apply erosion:        " << 1e3 * m_loader->m_timer_bulldozing_erosion() << std::endl;
+    os << "   Coarsening:              " << 1e3 * m_loader->m_timer_coarsening() << std::endl;
     os << "   Visualization:           " << 1e3 * m_loader->m_timer_visualization() << std::endl;
 
     os << " Counters:" << std::endl;
@@ -306,6 +340,7 @@ void SCMTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number ray hits:         " << m_loader->m_num_ray_hits << std::endl;
     os << "   Number contact patches:  " << m_loader->m_num_contact_patches << std::endl;
     os << "   Number erosion nodes:    " << m_loader->m_num_erosion_nodes << std::endl;
+    os << "   Number coarsened nodes:  " << m_loader->m_num_coarsened_nodes << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -365,6 +400,15 @@ SCMLoader::SCMLoader(ChSystem* system, bool visualization_mesh) : m_soil_fun(nul
     m_test_offset_down = 0.5;
 
     m_moving_patch = false;
+    m_patch_ray_casting = false;
+
+    m_multires = false;
+    m_coarsening_factor = 4;
+    m_coarsening_distance = 1.0;
+
+    m_num_coarsened_nodes = 0;
+
+    m_delta_header = false;
 }
 
 // Initialize the terrain as a flat grid
@@ -678,27 +722,17 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector<>& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2<int> ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
-        return ni;
-    }
-
-    // Return a default node record
-    ni.sinkage = 0;
-    ni.sinkage_plastic = 0;
-    ni.sinkage_elastic = 0;
-    ni.sigma = 0;
-    ni.sigma_yield = 0;
-    ni.kshear = 0;
-    ni.tau = 0;
+    // Query the grid of modified nodes. A node without a record has undeformed soil or, in multiresolution mode, the
+    // soil state interpolated from the coarse grid.
+    auto rec = m_grid_map.find(ij);
+    NodeRecord nr = rec ? *rec : CreateNodeRecord(ij);
+    ni.sinkage = nr.sinkage;
+    ni.sinkage_plastic = nr.sinkage_plastic;
+    ni.sinkage_elastic = nr.sinkage_elastic;
+    ni.sigma = nr.sigma;
+    ni.sigma_yield = nr.sigma_yield;
+    ni.kshear = nr.kshear;
+    ni.tau = nr.tau;
     return ni;
 }
 
@@ -769,15 +803,77 @@ ChVector<> SCMLoader::GetInitNormal(const ChVector2<int>& loc) const {
     }
 }
 
+// Floor of the integer division a / b (with b > 0).
+static inline int FloorDiv(int a, int b) {
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+// Get the level (relative to the SCM plane) of a grid node without a node record.
+double SCMLoader::GetBaseHeight(const ChVector2<int>& loc) const {
+    double z = GetInitHeight(loc);
+    if (m_coarse_map.size() == 0)
+        return z;
+
+    // Bilinear interpolation of the deformation at the corners of the coarse grid cell containing the node
+    const int f = m_coarsening_factor;
+    int I = FloorDiv(loc.x(), f);
+    int J = FloorDiv(loc.y(), f);
+    double ax = double(loc.x() - I * f) / f;
+    double ay = double(loc.y() - J * f) / f;
+    for (int b = 0; b < 2; b++) {
+        for (int a = 0; a < 2; a++) {
+            if (auto c = m_coarse_map.find(ChVector2<int>(I + a, J + b)))
+                z += (a ? ax : 1 - ax) * (b ? ay : 1 - ay) * c->deformation;
+        }
+    }
+    return z;
+}
+
+// Create the record of a grid node without a node record.
+// In multiresolution mode, the plastic sinkage and yield stress are interpolated from the coarse grid nodes (with
+// weights normalized over the coarse nodes with data) and the initial level is set above the current level by the
+// plastic sinkage, as for a node compacted at full resolution.
+SCMLoader::NodeRecord SCMLoader::CreateNodeRecord(const ChVector2<int>& loc) const {
+    double z = GetBaseHeight(loc);
+    NodeRecord nr(z, z, GetInitNormal(loc));
+    if (m_coarse_map.size() == 0)
+        return nr;
+
+    const int f = m_coarsening_factor;
+    int I = FloorDiv(loc.x(), f);
+    int J = FloorDiv(loc.y(), f);
+    double ax = double(loc.x() - I * f) / f;
+    double ay = double(loc.y() - J * f) / f;
+    double weight = 0;
+    double sinkage_plastic = 0;
+    double sigma_yield = 0;
+    for (int b = 0; b < 2; b++) {
+        for (int a = 0; a < 2; a++) {
+            if (auto c = m_coarse_map.find(ChVector2<int>(I + a, J + b))) {
+                double w = (a ? ax : 1 - ax) * (b ? ay : 1 - ay);
+                weight += w;
+                sinkage_plastic += w * c->sinkage_plastic;
+                sigma_yield += w * c->sigma_yield;
+            }
+        }
+    }
+    if (weight > 0) {
+        nr.sinkage_plastic = sinkage_plastic / weight;
+        nr.sigma_yield = sigma_yield / weight;
+        nr.sinkage = nr.sinkage_plastic;
+        nr.level_initial = z + nr.sinkage_plastic;
+    }
+    return nr;
+}
+
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2<int>& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid_map.find(loc))
+        return nr->level;
 
-    // Else return undeformed height
-    return GetInitHeight(loc);
+    // Else return undeformed height (including coarse deformation, if any)
+    return GetBaseHeight(loc);
 }
 
 // Get the terrain normal (relative to the SCM plane) at the specified grid vertex.
@@ -991,9 +1087,8 @@ static const std::vector<ChVector2<int>> neighbors4{
     ChVector2<int>(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
-////#define RAY_CASTING_WITH_CRITICAL_SECTION
+// Ray casting is performed with one batch of rays per patch, processed in parallel by the collision system.
+// Ray intersection hits are then collected sequentially.
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMLoader::ComputeInternalForces() {
@@ -1011,12 +1106,8 @@ void SCMLoader::ComputeInternalForces() {
         nr.erosion = false;
         nr.hit_level = 1e9;
 
-        // Update visualization (only color changes relevant here)
-        if (m_trimesh_shape && CheckMeshBounds(ij)) {
-            int iv = GetMeshVertexIndex(ij);          // mesh vertex index
-            UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
-            modified_vertices.push_back(iv);
-        }
+        // Mark for visualization update (only color changes relevant here)
+        MarkDirtyNode(ij, false);
     }
 
     m_modified_nodes.clear();
@@ -1031,6 +1122,7 @@ void SCMLoader::ComputeInternalForces() {
     m_timer_bulldozing_boundary.reset();
     m_timer_bulldozing_domain.reset();
     m_timer_bulldozing_erosion.reset();
+    m_timer_coarsening.reset();
     m_timer_visualization.reset();
 
     // Reset the load list and map of contact forces
@@ -1054,6 +1146,18 @@ void SCMLoader::ComputeInternalForces() {
 
     m_timer_moving_patches.stop();
 
+    // ------------------------------------------
+    // Coarsen grid nodes far from moving patches
+    // ------------------------------------------
+
+    m_timer_coarsening.start();
+
+    m_num_coarsened_nodes = 0;
+    if (m_multires)
+        CoarsenGrid();
+
+    m_timer_coarsening.stop();
+
     // -------------------------
     // Perform ray casting tests
     // -------------------------
@@ -1063,135 +1167,106 @@ void SCMLoader::ComputeInternalForces() {
         ChContactable* contactable;  // pointer to hit object
         ChVector<> abs_point;        // hit point, expressed in global frame
         int patch_id;                // index of associated patch id
+        double dist_factor;          // hit location along the ray
     };
 
-    // Hash-map for vertices with ray-cast hits
-    std::unordered_map<ChVector2<int>, HitRecord, CoordHash> hits;
+    // List of vertices with ray-cast hits (the index of each hit vertex in this list is stored in m_hit_ids)
+    std::vector<std::pair<ChVector2<int>, HitRecord>> hits;
 
     m_num_ray_casts = 0;
     m_num_ray_hits = 0;
 
     m_timer_ray_casting.start();
 
-#ifdef RAY_CASTING_WITH_CRITICAL_SECTION
+    const int nthreads = GetSystem()->GetNumThreadsChrono();
 
-    int nthreads = GetSystem()->GetNumThreadsChrono();
+    // Candidate rays at the patch grid nodes and rays cast into the collision system (with their grid nodes)
+    std::vector<ChVector<>> node_from;
+    std::vector<ChVector<>> node_to;
+    std::vector<char> node_cast;
+    std::vector<ChVector<>> ray_from;
+    std::vector<ChVector<>> ray_to;
+    std::vector<ChVector2<int>> ray_nodes;
+    std::vector<collision::ChCollisionSystem::ChRayhitResult> ray_results;
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
+        int num_nodes = (int)p.m_range.size();
+        node_from.resize(num_nodes);
+        node_to.resize(num_nodes);
+        node_cast.resize(num_nodes);
+
+        // Create rays at all vertices in the patch range
+    #pragma omp parallel for num_threads(nthreads)
+        for (int k = 0; k < num_nodes; k++) {
             ChVector2<int> ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
             double x = ij.x() * m_delta;
             double y = ij.y() * m_delta;
-            double z;
-    #pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
+            double z = GetHeight(ij);
 
             ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
 
             // Create ray at current grid location
-            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
+            node_to[k] = vertex_abs + m_Z * m_test_offset_up;
+            node_from[k] = node_to[k] - m_Z * m_test_offset_down;
 
             // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-    #pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
+            node_cast[k] = !m_moving_patch || RayOBBtest(p, node_from[k], m_Z);
+        }
 
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
-                }
+        ray_from.clear();
+        ray_to.clear();
+        ray_nodes.clear();
+        for (int k = 0; k < num_nodes; k++) {
+            if (node_cast[k]) {
+                ray_from.push_back(node_from[k]);
+                ray_to.push_back(node_to[k]);
+                ray_nodes.push_back(p.m_range[k]);
             }
         }
-        m_num_ray_casts += num_ray_casts;
-    }
-
-#else
 
-    // Map-reduce approach (to eliminate critical section)
-
-    const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2<int>, HitRecord, CoordHash>> t_hits(nthreads);
-
-    // Loop through all moving patches (user-defined or default one)
-    for (auto& p : m_patches) {
+        // Cast all rays into the collision system (processed in parallel by the collision system).
+        // If so requested, test the rays of a moving patch only against the collision model of the patch body.
+        auto model = (m_moving_patch && m_patch_ray_casting) ? p.m_body->GetCollisionModel().get() : nullptr;
         m_timer_ray_testing.start();
+        GetSystem()->GetCollisionSystem()->RayHitBatch(ray_from, ray_to, ray_results, model);
+        m_timer_ray_testing.stop();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
-            ChVector2<int> ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z = GetHeight(ij);
-
-            ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
-
-            // Create ray at current grid location
-            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
+        m_num_ray_casts += (int)ray_from.size();
 
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
+        // Sequential insertion in global hits
+        for (size_t k = 0; k < ray_nodes.size(); k++) {
+            if (!ray_results[k].hit)
                 continue;
 
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
-            }
-        }
-
-        m_timer_ray_testing.stop();
-
-        m_num_ray_casts += num_ray_casts;
+            const auto& ij = ray_nodes[k];
 
-        // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
+            // For additional hits from this node (from overlapping patches), keep the lowest one
+            if (auto id = m_hit_ids.find(ij)) {
+                auto& record = hits[*id].second;
+                if (ray_results[k].dist_factor < record.dist_factor) {
+                    record.contactable = ray_results[k].hitModel->GetContactable();
+                    record.abs_point = ray_results[k].abs_hitPoint;
+                    record.dist_factor = ray_results[k].dist_factor;
                 }
-                ////hits.insert(h);
+                continue;
             }
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+            // If this is the first hit from this node, initialize the node record
+            if (!m_grid_map.find(ij))
+                m_grid_map.insert(ij, CreateNodeRecord(ij));
+
+            // Add to our list of hits to process
+            HitRecord record = {ray_results[k].hitModel->GetContactable(), ray_results[k].abs_hitPoint, -1,
+                                ray_results[k].dist_factor};
+            m_hit_ids.insert(ij, (int)hits.size());
+            hits.push_back(std::make_pair(ij, record));
         }
-        m_num_ray_hits = (int)hits.size();
     }
 
-#endif
+    m_num_ray_hits = (int)hits.size();
 
     m_timer_ray_casting.stop();
 
@@ -1231,24 +1306,25 @@ void SCMLoader::ComputeInternalForces() {
         todo.push(ij);
 
         while (!todo.empty()) {
-            auto crt = hits.find(todo.front());  // Current hit node is first element in queue
-            todo.pop();                          // Remove first element from queue
+            auto& crt = hits[m_hit_ids.at(todo.front())];  // Current hit node is first element in queue
+            todo.pop();                                    // Remove first element from queue
 
-            ChVector2<int> crt_ij = crt->first;
-            int crt_patch = crt->second.patch_id;
+            ChVector2<int> crt_ij = crt.first;
+            int crt_patch = crt.second.patch_id;
 
             // Loop through the neighbors of the current hit node
             for (int k = 0; k < 4; k++) {
                 ChVector2<int> nbr_ij = crt_ij + neighbors4[k];
                 // If neighbor is not a hit node, move on
-                auto nbr = hits.find(nbr_ij);
-                if (nbr == hits.end())
+                auto nbr_id = m_hit_ids.find(nbr_ij);
+                if (!nbr_id)
                     continue;
+                auto& nbr = hits[*nbr_id];
                 // If neighbor already assigned to a contact patch, move on
-                if (nbr->second.patch_id != -1)
+                if (nbr.second.patch_id != -1)
                     continue;
                 // Assign neighbor to the same contact patch
-                nbr->second.patch_id = crt_patch;
+                nbr.second.patch_id = crt_patch;
                 // Add neighbor point to patch lists
                 patch.nodes.push_back(nbr_ij);
                 patch.points.push_back(ChVector2<>(m_delta * nbr_ij.x(), m_delta * nbr_ij.y()));
@@ -1259,6 +1335,10 @@ void SCMLoader::ComputeInternalForces() {
         contact_patches.push_back(patch);
     }
 
+    // Reset the grid of hit indices for the next step
+    for (const auto& h : hits)
+        m_hit_ids.erase(h.first);
+
     // Calculate area and perimeter of each contact patch.
     // Calculate approximation to Beker term 1/b.
     for (auto& p : contact_patches) {
@@ -1280,29 +1360,40 @@ void SCMLoader::ComputeInternalForces() {
 
     m_timer_contact_forces.start();
 
-    // Initialize local values for the soil parameters
-    double Bekker_Kphi = m_Bekker_Kphi;
-    double Bekker_Kc = m_Bekker_Kc;
-    double Bekker_n = m_Bekker_n;
-    double Mohr_cohesion = m_Mohr_cohesion;
-    double Mohr_mu = m_Mohr_mu;
-    double Janosi_shear = m_Janosi_shear;
-    double elastic_K = m_elastic_K;
-    double damping_R = m_damping_R;
+    // Contact force at each hit node (computed in parallel, then applied sequentially in the order of the hits)
+    struct HitForce {
+        bool active;           // true if the node is touched (positive pressure)
+        ChVector<> point_abs;  // force application point, expressed in global frame
+        ChVector<> force;      // contact force, expressed in global frame
+    };
+    const int num_hits = (int)hits.size();
+    std::vector<HitForce> hit_forces(num_hits);
 
     // Process only hit nodes
-    for (auto& h : hits) {
-        ChVector2<> ij = h.first;
+    #pragma omp parallel for num_threads(nthreads)
+    for (int ih = 0; ih < num_hits; ih++) {
+        const ChVector2<int>& ij = hits[ih].first;
+        hit_forces[ih].active = false;
 
         auto& nr = m_grid_map.at(ij);      // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
-        ChContactable* contactable = h.second.contactable;
-        const ChVector<>& hit_point_abs = h.second.abs_point;
-        int patch_id = h.second.patch_id;
+        ChContactable* contactable = hits[ih].second.contactable;
+        const ChVector<>& hit_point_abs = hits[ih].second.abs_point;
+        int patch_id = hits[ih].second.patch_id;
 
         auto hit_point_loc = m_plane.TransformPointParentToLocal(hit_point_abs);
 
+        // Initialize local values for the soil parameters
+        double Bekker_Kphi = m_Bekker_Kphi;
+        double Bekker_Kc = m_Bekker_Kc;
+        double Bekker_n = m_Bekker_n;
+        double Mohr_cohesion = m_Mohr_cohesion;
+        double Mohr_mu = m_Mohr_mu;
+        double Janosi_shear = m_Janosi_shear;
+        double elastic_K = m_elastic_K;
+        double damping_R = m_damping_R;
+
         if (m_soil_fun) {
             double Mohr_friction;
             m_soil_fun->Set(hit_point_loc, Bekker_Kphi, Bekker_Kc, Bekker_n, Mohr_cohesion, Mohr_friction, Janosi_shear,
@@ -1322,9 +1413,6 @@ void SCMLoader::ComputeInternalForces() {
             continue;
         }
 
-        // Mark current node as modified
-        m_modified_nodes.push_back(ij);
-
         // Calculate velocity at touched grid node
         ChVector<> point_local(ij.x() * m_delta, ij.y() * m_delta, nr.level);
         ChVector<> point_abs = m_plane.TransformPointLocalToParent(point_local);
@@ -1385,12 +1473,33 @@ void SCMLoader::ComputeInternalForces() {
             Ft = T * m_area * nr.tau;
         }
 
+        hit_forces[ih].active = true;
+        hit_forces[ih].point_abs = point_abs;
+        hit_forces[ih].force = Fn + Ft;
+
+        // Update grid node height (in local SCM frame, along SCM z axis)
+        nr.level = nr.level_initial - nr.sinkage / ca;
+
+    }  // end loop on ray hits
+
+    // Apply the contact forces at touched nodes
+    for (int ih = 0; ih < num_hits; ih++) {
+        if (!hit_forces[ih].active)
+            continue;
+
+        // Mark current node as modified
+        m_modified_nodes.push_back(hits[ih].first);
+
+        ChContactable* contactable = hits[ih].second.contactable;
+        const ChVector<>& point_abs = hit_forces[ih].point_abs;
+        const ChVector<>& force = hit_forces[ih].force;
+
         if (ChBody* rigidbody = dynamic_cast<ChBody*>(contactable)) {
             // [](){} Trick: no deletion for this shared ptr, since 'rigidbody' was not a new ChBody()
             // object, but an already used pointer because mrayhit_result.hitModel->GetPhysicsItem()
             // cannot return it as shared_ptr, as needed by the ChLoadBodyForce:
             std::shared_ptr<ChBody> srigidbody(rigidbody, [](ChBody*) {});
-            std::shared_ptr<ChLoadBodyForce> mload(new ChLoadBodyForce(srigidbody, Fn + Ft, false, point_abs, false));
+            std::shared_ptr<ChLoadBodyForce> mload(new ChLoadBodyForce(srigidbody, force, false, point_abs, false));
             this->Add(mload);
 
             // Accumulate contact force for this rigid body.
@@ -1399,7 +1508,6 @@ void SCMLoader::ComputeInternalForces() {
             auto itr = m_contact_forces.find(contactable);
             if (itr == m_contact_forces.end()) {
                 // Create new entry and initialize generalized force.
-                ChVector<> force = Fn + Ft;
                 TerrainForce frc;
                 frc.point = srigidbody->GetPos();
                 frc.force = force;
@@ -1407,7 +1515,6 @@ void SCMLoader::ComputeInternalForces() {
                 m_contact_forces.insert(std::make_pair(contactable, frc));
             } else {
                 // Update generalized force.
-                ChVector<> force = Fn + Ft;
                 itr->second.force += force;
                 itr->second.moment += Vcross(Vsub(point_abs, srigidbody->GetPos()), force);
             }
@@ -1415,18 +1522,14 @@ void SCMLoader::ComputeInternalForces() {
             // [](){} Trick: no deletion for this shared ptr
             std::shared_ptr<ChLoadableUV> ssurf(surf, [](ChLoadableUV*) {});
             std::shared_ptr<ChLoad<ChLoaderForceOnSurface>> mload(new ChLoad<ChLoaderForceOnSurface>(ssurf));
-            mload->loader.SetForce(Fn + Ft);
+            mload->loader.SetForce(force);
             mload->loader.SetApplication(0.5, 0.5);  //***TODO*** set UV, now just in middle
             this->Add(mload);
 
             // Accumulate contact forces for this surface.
             //// TODO
         }
-
-        // Update grid node height (in local SCM frame, along SCM z axis)
-        nr.level = nr.level_initial - nr.sinkage / ca;
-
-    }  // end loop on ray hits
+    }
 
     m_timer_contact_forces.stop();
 
@@ -1462,9 +1565,10 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
+                    auto nbr_nr = m_grid_map.find(nbr_ij);            //     neighbor node record
+                    if (!nbr_nr)                                      //     if neighbor not yet recorded
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
+                    else if (nbr_nr->sigma <= 0)                      //     if neighbor not touched
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
                 }
             }
@@ -1476,10 +1580,8 @@ void SCMLoader::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
-                    double z = GetInitHeight(ij);                                //     undeformed height
-                    const ChVector<>& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
+                if (!m_grid_map.find(ij)) {                                      //   if not yet recorded
+                    m_grid_map.insert(ij, CreateNodeRecord(ij));                 //     add new node record
                     m_modified_nodes.push_back(ij);                              //     mark as modified
                 }                                                                //
                 auto& nr = m_grid_map.at(ij);                                    //   node record
@@ -1506,12 +1608,10 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
-                        double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
-                        const ChVector<>& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
-                        NodeRecord nr(z, z, n);                         //     create new record
+                    if (!m_grid_map.find(nbr_ij)) {                     //   if neighbor not yet recorded
+                        NodeRecord nr = CreateNodeRecord(nbr_ij);       //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid_map.insert(nbr_ij, nr);                  //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
@@ -1534,34 +1634,46 @@ void SCMLoader::ComputeInternalForces() {
         // (3) Erosion algorithm on domain
         m_timer_bulldozing_erosion.start();
 
-        for (int iter = 0; iter < m_erosion_iterations; iter++) {
-            for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
-                for (int k = 0; k < 4; k++) {
-                    ChVector2<int> nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
-                        continue;
-                    auto& nbr_nr = rec->second;
-
-                    // (3.1) Flow remaining material to neighbor
-                    double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
-                    if (diff > 0) {
-                        RemoveMaterialFromNode(diff, nr);
-                        AddMaterialToNode(diff, nbr_nr);
-                    }
+        // Partition the erosion domain into 5 sets of nodes with disjoint neighborhoods (node (i,j) in the set with
+        // index (i + 2j) mod 5). The nodes in each set can be processed in parallel and in any order, with results that
+        // do not depend on the number of threads.
+        std::vector<ChVector2<int>> erosion_sets[5];
+        for (const auto& ij : erosion_domain)
+            erosion_sets[((ij.x() + 2 * ij.y()) % 5 + 5) % 5].push_back(ij);
 
-                    // (3.2) Smoothing
-                    if (nbr_nr.sigma == 0) {
-                        double dy = (nr.level + nr.massremainder) - (nbr_nr.level + nbr_nr.massremainder);
-                        diff = 0.5 * (std::abs(dy) - dy_lim) / 4;  //// TODO: rethink this!
+        for (int iter = 0; iter < m_erosion_iterations; iter++) {
+            for (const auto& erosion_set : erosion_sets) {
+                const int num_set_nodes = (int)erosion_set.size();
+    #pragma omp parallel for num_threads(nthreads)
+                for (int in = 0; in < num_set_nodes; in++) {
+                    const auto& ij = erosion_set[in];
+                    auto& nr = m_grid_map.at(ij);
+                    for (int k = 0; k < 4; k++) {
+                        ChVector2<int> nbr_ij = ij + neighbors4[k];
+                        auto rec = m_grid_map.find(nbr_ij);
+                        if (!rec)
+                            continue;
+                        auto& nbr_nr = *rec;
+
+                        // (3.1) Flow remaining material to neighbor
+                        double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
                         if (diff > 0) {
-                            if (dy > 0) {
-                                RemoveMaterialFromNode(diff, nr);
-                                AddMaterialToNode(diff, nbr_nr);
-                            } else {
-                                RemoveMaterialFromNode(diff, nbr_nr);
-                                AddMaterialToNode(diff, nr);
+                            RemoveMaterialFromNode(diff, nr);
+                            AddMaterialToNode(diff, nbr_nr);
+                        }
+
+                        // (3.2) Smoothing
+                        if (nbr_nr.sigma == 0) {
+                            double dy = (nr.level + nr.massremainder) - (nbr_nr.level + nbr_nr.massremainder);
+                            diff = 0.5 * (std::abs(dy) - dy_lim) / 4;  //// TODO: rethink this!
+                            if (diff > 0) {
+                                if (dy > 0) {
+                                    RemoveMaterialFromNode(diff, nr);
+                                    AddMaterialToNode(diff, nbr_nr);
+                                } else {
+                                    RemoveMaterialFromNode(diff, nbr_nr);
+                                    AddMaterialToNode(diff, nr);
+                                }
                             }
                         }
                     }
@@ -1581,26 +1693,187 @@ void SCMLoader::ComputeInternalForces() {
 
     m_timer_visualization.start();
 
-    if (m_trimesh_shape) {
-        // Loop over list of modified nodes and adjust corresponding mesh vertices.
-        // If not rendering a wireframe mesh, also update normals.
-        for (const auto& ij : m_modified_nodes) {
-            if (!CheckMeshBounds(ij))                 // if node outside mesh
-                continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
-            int iv = GetMeshVertexIndex(ij);          // mesh vertex index
-            UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
-            modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
-            if (!m_trimesh_shape->IsWireframe())      // if not wireframe
-                UpdateMeshVertexNormal(ij, iv);       // update vertex normal
-        }
+    // Process each modified node only once (a node may appear multiple times in the list of modified nodes)
+    for (const auto& ij : m_modified_nodes)
+        MarkDirtyNode(ij, true);
+
+    ProcessDirtyNodes(modified_vertices);
 
+    if (m_trimesh_shape)
         m_trimesh_shape->SetModifiedVertices(modified_vertices);
-    }
 
     m_timer_visualization.stop();
 }
 
+// Transfer the deformation at grid nodes far from all patches to the coarse grid and release their node records.
+// The residual at each released node (node level minus the level interpolated from the coarse grid) is distributed to
+// the corners of its coarse grid cell with the bilinear interpolation weights, scaled by the number of grid nodes per
+// coarse cell. Since the interpolation weights of each node sum up to one, this preserves the sum of the levels of all
+// grid nodes (and hence the displaced soil volume), except for the change of the interpolated levels below nodes which
+// keep their records. That change is accumulated in the node records and added to their residuals when coarsened.
+// The plastic sinkage and yield stress at each coarse grid node are set to the weighted averages over the nodes
+// released at this step. Both quantities only increase under loading (and recreated records start from the values
+// interpolated from the coarse grid), so the larger of the current and new values is kept.
+void SCMLoader::CoarsenGrid() {
+    struct Contribution {
+        double deformation;
+        double weight;
+        double sinkage_plastic;
+        double sigma_yield;
+    };
+    typedef std::unordered_map<ChVector2<int>, Contribution, CoordHash> CoarseMap;
+
+    const int f = m_coarsening_factor;
+    const double f2 = double(f * f);
+
+    // Coarsening distance, in grid nodes (beyond the reach of the erosion domain around the patches)
+    int dist = static_cast<int>(std::ceil(m_coarsening_distance / m_delta));
+    dist = std::max(dist, m_erosion_propagations + 2);
+
+    // Ranges of grid indices in the vicinity of the patches
+    std::vector<std::pair<ChVector2<int>, ChVector2<int>>> ranges;
+    for (const auto& p : m_patches) {
+        if (p.m_range.empty())
+            continue;
+        ranges.push_back(std::make_pair(p.m_range.front() - ChVector2<int>(dist, dist),
+                                        p.m_range.back() + ChVector2<int>(dist, dist)));
+    }
+
+    // Collect the grid nodes outside all ranges and accumulate their contributions at the coarse grid nodes
+    std::vector<ChVector2<int>> far_nodes;
+    CoarseMap contributions;
+    m_grid_map.for_each([&](const ChVector2<int>& ij, const NodeRecord& nr) {
+        for (const auto& r : ranges) {
+            if (ij.x() >= r.first.x() && ij.x() <= r.second.x() && ij.y() >= r.first.y() && ij.y() <= r.second.y())
+                return;
+        }
+        far_nodes.push_back(ij);
+
+        double residual = nr.level - GetBaseHeight(ij) + nr.coarse_offset;
+        int I = FloorDiv(ij.x(), f);
+        int J = FloorDiv(ij.y(), f);
+        int ri = ij.x() - I * f;
+        int rj = ij.y() - J * f;
+        for (int b = 0; b < 2; b++) {
+            for (int a = 0; a < 2; a++) {
+                double w = (a ? ri : f - ri) * (b ? rj : f - rj) / f2;
+                if (w > 0) {
+                    auto& c = contributions.insert({ChVector2<int>(I + a, J + b), {0, 0, 0, 0}}).first->second;
+                    c.deformation += w * residual / f2;
+                    c.weight += w;
+                    c.sinkage_plastic += w * nr.sinkage_plastic;
+                    c.sigma_yield += w * nr.sigma_yield;
+                }
+            }
+        }
+    });
+
+    m_num_coarsened_nodes = static_cast<int>(far_nodes.size());
+    if (far_nodes.empty())
+        return;
+
+    // Release the node records (and the emptied tiles) and update the coarse grid
+    for (const auto& ij : far_nodes)
+        m_grid_map.erase(ij);
+    m_grid_map.shrink_to_fit();
+    for (const auto& c : contributions) {
+        auto& cr = m_coarse_map[c.first];
+        cr.deformation += c.second.deformation;
+        cr.sinkage_plastic = std::max(cr.sinkage_plastic, c.second.sinkage_plastic / c.second.weight);
+        cr.sigma_yield = std::max(cr.sigma_yield, c.second.sigma_yield / c.second.weight);
+    }
+
+    // Visit all grid nodes influenced by the modified coarse grid nodes. Accumulate the change of the interpolated
+    // level at nodes with a record and mark the other nodes as changed.
+    for (const auto& c : contributions) {
+        if (c.second.deformation == 0)
+            continue;
+        for (int dj = 1 - f; dj < f; dj++) {
+            for (int di = 1 - f; di < f; di++) {
+                ChVector2<int> ij(c.first.x() * f + di, c.first.y() * f + dj);
+                if (auto nr = m_grid_map.find(ij))
+                    nr->coarse_offset += (f - std::abs(di)) * (f - std::abs(dj)) / f2 * c.second.deformation;
+                else
+                    MarkDirtyNode(ij, true);
+            }
+        }
+    }
+
+    // Mark the released nodes as changed (for visualization update of the nodes with no residual)
+    for (const auto& ij : far_nodes)
+        MarkDirtyNode(ij, true);
+}
+
+// Mark the specified grid node as changed over the current step.
+// Changed nodes are tracked only if they are needed for the visualization mesh or for the delta output.
+void SCMLoader::MarkDirtyNode(const ChVector2<int>& ij, bool level_changed) {
+    if (!m_trimesh_shape && (!level_changed || !m_delta_stream.is_open()))
+        return;
+    m_dirty_map.insert(ij, 0) |= (level_changed ? 2 : 1);
+}
+
+// Update the visualization mesh at the grid nodes changed over the current step and write the changed levels to the
+// delta output. The changed nodes are stored in the tiles of the dirty map, so that only the tiles touched during the
+// current step are traversed. The dirty map is reset for the next step.
+void SCMLoader::ProcessDirtyNodes(std::vector<int>& modified_vertices) {
+    struct DeltaNode {
+        int32_t i;
+        int32_t j;
+        float level;
+    };
+    std::vector<DeltaNode> delta_nodes;
+    std::vector<std::pair<ChVector2<int>, int>> normal_nodes;
+
+    m_dirty_map.for_each([&](const ChVector2<int>& ij, char flag) {
+        auto nr = m_grid_map.find(ij);
+        double z = nr ? nr->level : GetBaseHeight(ij);
+
+        // Update mesh vertex coordinates and color (vertex normals updated after all vertices are moved)
+        if (m_trimesh_shape && CheckMeshBounds(ij)) {
+            int iv = GetMeshVertexIndex(ij);
+            UpdateMeshVertexCoordinates(ij, iv, nr ? *nr : NodeRecord(z, z, GetInitNormal(ij)));
+            modified_vertices.push_back(iv);
+            if ((flag & 2) && !m_trimesh_shape->IsWireframe())
+                normal_nodes.push_back(std::make_pair(ij, iv));
+        }
+
+        // Cache changed level for delta output
+        if ((flag & 2) && m_delta_stream.is_open())
+            delta_nodes.push_back({ij.x(), ij.y(), static_cast<float>(z)});
+    });
+
+    for (const auto& n : normal_nodes)
+        UpdateMeshVertexNormal(n.first, n.second);
+
+    m_dirty_map.clear();
+
+    if (!m_delta_stream.is_open())
+        return;
+
+    // Write header (once) and frame for current step
+    if (!m_delta_header) {
+        int32_t nx = m_nx;
+        int32_t ny = m_ny;
+        double plane[7] = {m_plane.pos.x(),   m_plane.pos.y(),   m_plane.pos.z(),  m_plane.rot.e0(),
+                           m_plane.rot.e1(), m_plane.rot.e2(), m_plane.rot.e3()};
+        m_delta_stream.write(reinterpret_cast<const char*>(&m_delta), sizeof(double));
+        m_delta_stream.write(reinterpret_cast<const char*>(&nx), sizeof(int32_t));
+        m_delta_stream.write(reinterpret_cast<const char*>(&ny), sizeof(int32_t));
+        m_delta_stream.write(reinterpret_cast<const char*>(plane), sizeof(plane));
+        m_delta_header = true;
+    }
+
+    double time = GetSystem()->GetChTime();
+    int32_t num_nodes = static_cast<int32_t>(delta_nodes.size());
+    m_delta_stream.write(reinterpret_cast<const char*>(&time), sizeof(double));
+    m_delta_stream.write(reinterpret_cast<const char*>(&num_nodes), sizeof(int32_t));
+    for (const auto& n : delta_nodes) {
+        m_delta_stream.write(reinterpret_cast<const char*>(&n.i), sizeof(int32_t));
+        m_delta_stream.write(reinterpret_cast<const char*>(&n.j), sizeof(int32_t));
+        m_delta_stream.write(reinterpret_cast<const char*>(&n.level), sizeof(float));
+    }
+}
+
 void SCMLoader::AddMaterialToNode(double amount, NodeRecord& nr) {
     if (amount > nr.hit_level - nr.level) {                      //   if not possible to assign all mass
         nr.massremainder += amount - (nr.hit_level - nr.level);  //     material to be further propagated
@@ -1710,14 +1983,34 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2<int> ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
+        nodes.reserve(m_grid_map.size());
+        m_grid_map.for_each(
+            [&nodes](const ChVector2<int>& ij, const NodeRecord& nr) { nodes.push_back(std::make_pair(ij, nr.level)); });
+
+        // Include the deformed grid nodes without a record, influenced by the coarse grid nodes (multiresolution mode)
+        const int f = m_coarsening_factor;
+        std::unordered_set<ChVector2<int>, CoordHash> coarse_nodes;
+        m_coarse_map.for_each([&](const ChVector2<int>& IJ, const CoarseRecord& c) {
+            if (c.deformation == 0)
+                return;
+            for (int dj = 1 - f; dj < f; dj++) {
+                for (int di = 1 - f; di < f; di++) {
+                    ChVector2<int> ij(IJ.x() * f + di, IJ.y() * f + dj);
+                    if (!m_grid_map.find(ij))
+                        coarse_nodes.insert(ij);
+                }
+            }
+        });
+        for (const auto& ij : coarse_nodes) {
+            double level = GetBaseHeight(ij);
+            if (level != GetInitHeight(ij))
+                nodes.push_back(std::make_pair(ij, level));
         }
     } else {
         for (const auto& ij : m_modified_nodes) {
             auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            assert(rec);
+            nodes.push_back(std::make_pair(ij, rec->level));
         }
     }
     return nodes;
@@ -1730,6 +2023,10 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
     for (const auto& n : nodes) {
         // Modify existing entry in grid map or insert new one
         m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+
+        // Include in the delta output at the next step
+        if (m_delta_stream.is_open())
+            MarkDirtyNode(n.first, true);
     }
 
     // Update visualization
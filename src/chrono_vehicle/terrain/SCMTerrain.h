@@ -22,7 +22,11 @@
 
 #include <string>
 #include <ostream>
+#include <fstream>
 #include <unordered_map>
+#include <memory>
+#include <vector>
+#include <cassert>
 
 #include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/physics/ChBody.h"
@@ -156,8 +160,34 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
                         const ChVector<>& OOBB_dims     ///< [in] OOBB dimensions
     );
 
+    /// Enable ray casting against the moving patch bodies only (default: false).
+    /// If enabled, the rays at the grid nodes of each moving patch are tested directly against the collision model of
+    /// the body associated with that patch (any collision shape type supported by the collision system), bypassing the
+    /// ray queries against the entire collision system. For nodes in overlapping patches, the lowest hit is used.
+    /// Note that, in this mode, any other collision shapes in the patch areas do not interact with the SCM terrain.
+    /// This setting has no effect if no moving patches are defined.
+    void EnablePatchRayCasting(bool val);
+
+    /// Enable the multiresolution mode (default: false).
+    /// If enabled, node records are kept at the full SCM grid resolution only in the vicinity of the moving patches (or
+    /// of the bounding box of all collision shapes, if no moving patches are defined). Records of grid nodes farther
+    /// than the specified distance from all patches are released and their deformation (level change relative to the
+    /// undeformed terrain) is transferred, preserving the displaced soil volume, to a coarse grid with a spacing
+    /// 'coarsening_factor' times larger. The level of a grid node without a record is obtained by adding the deformation
+    /// interpolated from the coarse grid to the undeformed terrain level. Node records are recreated at this level when
+    /// a patch returns over a coarsened region, so that contact forces and bulldozing effects are always computed at
+    /// full resolution. The coarsening distance is increased if needed to exceed the extent of the erosion domain.
+    /// The plastic sinkage and yield stress of released nodes are also kept on the coarse grid (as local averages) and
+    /// restored in recreated node records, so that soil compacted by a previous pass remains stiffer. Since this
+    /// history is smoothed over a coarse grid cell, the response to repeated passes over coarsened regions is an
+    /// approximation of that obtained at full resolution.
+    /// For large terrains, consider also disabling the visualization mesh (see the SCMTerrain constructor).
+    void EnableMultiresolution(bool val, int coarsening_factor = 4, double coarsening_distance = 1.0);
+
     /// Class to be used as a callback interface for location-dependent soil parameters.
     /// A derived class must implement Set() and set *all* soil parameters (no defaults are provided).
+    /// Set() is called concurrently from multiple threads (if the system uses more than one Chrono thread) and must
+    /// therefore be thread-safe.
     class CH_VEHICLE_API SoilParametersCallback {
       public:
         virtual ~SoilParametersCallback() {}
@@ -215,6 +245,14 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Save the visualization mesh as a Wavefront OBJ file.
     void WriteMesh(const std::string& filename) const;
 
+    /// Enable output of the terrain changes at each step to the specified binary file (for offline rendering).
+    /// The file starts with a header with the grid spacing (double), the grid index ranges nx and ny (int32), and the
+    /// SCM reference plane (position and rotation quaternion, 7 doubles). At each step, a frame is appended with the
+    /// simulation time (double), the number of grid nodes whose level changed during the step (int32) and, for each
+    /// such node, its grid indices (2 x int32) and its level relative to the SCM plane (float). This output does not
+    /// require a visualization mesh. Pass an empty filename to disable the output.
+    void SetDeltaOutput(const std::string& filename);
+
     /// Initialize the terrain system (flat).
     /// This version creates a flat array of points.
     void Initialize(double sizeX,  ///< [in] terrain dimension in the X direction
@@ -254,7 +292,9 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
 
     /// Get the heights of all modified grid nodes.
     /// If 'all_nodes = true', return modified nodes from the start of simulation.  Otherwise, return only the nodes
-    /// modified over the last step.
+    /// modified over the last step. In multiresolution mode, the list of all modified nodes also includes the nodes in
+    /// coarsened regions, at their level interpolated from the coarse grid, so that it describes the entire terrain
+    /// deformation (e.g., for checkpointing with SetModifiedNodes).
     std::vector<NodeLevel> GetModifiedNodes(bool all_nodes = false) const;
 
     /// Modify the level of grid nodes from the given list.
@@ -271,6 +311,8 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     int GetNumContactPatches() const;
     /// Return the number of nodes in the erosion domain at last step (bulldosing effects).
     int GetNumErosionNodes() const;
+    /// Return the number of grid nodes coarsened at last step (multiresolution mode).
+    int GetNumCoarsenedNodes() const;
 
     /// Return time for updating moving patches at last step (ms).
     double GetTimerMovingPatches() const;
@@ -284,6 +326,8 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     double GetTimerContactForces() const;
     /// Return time for computing bulldozing effects at last step (ms).
     double GetTimerBulldozing() const;
+    /// Return time for coarsening grid nodes at last step (ms).
+    double GetTimerCoarsening() const;
     /// Return time for visualization assets update at last step (ms).
     double GetTimerVisUpdate() const;
 
@@ -376,6 +420,7 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         bool erosion;              // for bulldozing
         double massremainder;      // for bulldozing
         double step_plastic_flow;  // for bulldozing
+        double coarse_offset;      // coarse grid deformation below the node, not yet coarsened (multiresolution)
 
         NodeRecord() : NodeRecord(0, 0, ChVector<>(0, 0, 1)) {}
         ~NodeRecord() {}
@@ -394,7 +439,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
               tau(0),
               erosion(false),
               massremainder(0),
-              step_plastic_flow(0) {}
+              step_plastic_flow(0),
+              coarse_offset(0) {}
     };
 
     // Hash function for a pair of integer grid coordinates
@@ -404,6 +450,195 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         std::size_t operator()(const ChVector2<int>& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Sparse tiled storage for data at grid nodes.
+    // The grid is partitioned in square tiles of TILE_SIZE x TILE_SIZE nodes, each allocated on first access to one of
+    // its nodes and released when its last node is erased. A dense directory of tiles (grown as needed) covers the
+    // range of accessed nodes, so that accessing a node requires no hashing and neighboring nodes are (mostly) stored
+    // contiguously. The directory can be trimmed to the range of allocated tiles with shrink_to_fit().
+    template <typename T>
+    class TiledGrid {
+      public:
+        TiledGrid() : m_tx0(0), m_ty0(0), m_ntx(0), m_nty(0), m_size(0) {}
+
+        // Return a pointer to the value at the specified node (nullptr if no value was set at that node).
+        T* find(const ChVector2<int>& ij) {
+            Tile* tile = GetTile(ij);
+            if (!tile)
+                return nullptr;
+            int k = NodeIndex(ij);
+            return tile->used[k] ? &tile->data[k] : nullptr;
+        }
+        const T* find(const ChVector2<int>& ij) const { return const_cast<TiledGrid*>(this)->find(ij); }
+
+        // Return a reference to the value at the specified node (which must have been set).
+        T& at(const ChVector2<int>& ij) {
+            T* val = find(ij);
+            assert(val);
+            return *val;
+        }
+        const T& at(const ChVector2<int>& ij) const { return const_cast<TiledGrid*>(this)->at(ij); }
+
+        // Set the value at the specified node, if not already set. Return a reference to the value at that node.
+        T& insert(const ChVector2<int>& ij, const T& val) {
+            Tile& tile = AddTile(ij);
+            int k = NodeIndex(ij);
+            if (!tile.used[k]) {
+                tile.data[k] = val;
+                tile.used[k] = 1;
+                tile.count++;
+                m_size++;
+            }
+            return tile.data[k];
+        }
+
+        // Return a reference to the value at the specified node, default-initialized if not already set.
+        T& operator[](const ChVector2<int>& ij) { return insert(ij, T()); }
+
+        // Unset the value at the specified node. Release its tile if no other value is set in that tile.
+        void erase(const ChVector2<int>& ij) {
+            Tile* tile = GetTile(ij);
+            if (!tile)
+                return;
+            int k = NodeIndex(ij);
+            if (tile->used[k]) {
+                tile->used[k] = 0;
+                m_size--;
+                if (--tile->count == 0)
+                    m_tiles[((ij.y() >> TILE_BITS) - m_ty0) * m_ntx + ((ij.x() >> TILE_BITS) - m_tx0)].reset();
+            }
+        }
+
+        // Return the number of nodes with a value set.
+        size_t size() const { return m_size; }
+
+        // Unset all values and release all tiles.
+        void clear() {
+            m_tiles.clear();
+            m_tx0 = m_ty0 = 0;
+            m_ntx = m_nty = 0;
+            m_size = 0;
+        }
+
+        // Trim the tile directory to the range of allocated tiles.
+        void shrink_to_fit() {
+            int tx0 = m_ntx, ty0 = m_nty, tx1 = -1, ty1 = -1;
+            for (int ty = 0; ty < m_nty; ty++) {
+                for (int tx = 0; tx < m_ntx; tx++) {
+                    if (m_tiles[ty * m_ntx + tx]) {
+                        tx0 = std::min(tx0, tx);
+                        ty0 = std::min(ty0, ty);
+                        tx1 = std::max(tx1, tx);
+                        ty1 = std::max(ty1, ty);
+                    }
+                }
+            }
+            if (tx1 < 0) {
+                clear();
+                return;
+            }
+            if (tx0 == 0 && ty0 == 0 && tx1 == m_ntx - 1 && ty1 == m_nty - 1)
+                return;
+            int ntx = tx1 - tx0 + 1;
+            int nty = ty1 - ty0 + 1;
+            std::vector<std::unique_ptr<Tile>> tiles(ntx * nty);
+            for (int y = 0; y < nty; y++) {
+                for (int x = 0; x < ntx; x++)
+                    tiles[y * ntx + x] = std::move(m_tiles[(ty0 + y) * m_ntx + (tx0 + x)]);
+            }
+            m_tiles = std::move(tiles);
+            m_tx0 += tx0;
+            m_ty0 += ty0;
+            m_ntx = ntx;
+            m_nty = nty;
+        }
+
+        // Invoke the given function for all nodes with a value set, as func(ij, value).
+        template <typename F>
+        void for_each(F func) const {
+            for (int ty = 0; ty < m_nty; ty++) {
+                for (int tx = 0; tx < m_ntx; tx++) {
+                    const Tile* tile = m_tiles[ty * m_ntx + tx].get();
+                    if (!tile)
+                        continue;
+                    for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+                        if (tile->used[k])
+                            func(ChVector2<int>(((m_tx0 + tx) << TILE_BITS) + (k & TILE_MASK),
+                                                ((m_ty0 + ty) << TILE_BITS) + (k >> TILE_BITS)),
+                                 tile->data[k]);
+                    }
+                }
+            }
+        }
+
+      private:
+        static const int TILE_BITS = 6;
+        static const int TILE_SIZE = 1 << TILE_BITS;
+        static const int TILE_MASK = TILE_SIZE - 1;
+
+        struct Tile {
+            Tile() : data(TILE_SIZE * TILE_SIZE), used(TILE_SIZE * TILE_SIZE, 0), count(0) {}
+            std::vector<T> data;
+            std::vector<char> used;
+            int count;  // number of nodes with a value set
+        };
+
+        // Index of the node in its tile (arithmetic shift and masking work with negative coordinates)
+        static int NodeIndex(const ChVector2<int>& ij) {
+            return ((ij.y() & TILE_MASK) << TILE_BITS) | (ij.x() & TILE_MASK);
+        }
+
+        // Return the tile containing the specified node (nullptr if not allocated).
+        Tile* GetTile(const ChVector2<int>& ij) const {
+            int tx = (ij.x() >> TILE_BITS) - m_tx0;
+            int ty = (ij.y() >> TILE_BITS) - m_ty0;
+            if (tx < 0 || tx >= m_ntx || ty < 0 || ty >= m_nty)
+                return nullptr;
+            return m_tiles[ty * m_ntx + tx].get();
+        }
+
+        // Return the tile containing the specified node, allocating it (and growing the tile directory) if needed.
+        Tile& AddTile(const ChVector2<int>& ij) {
+            int tx = ij.x() >> TILE_BITS;
+            int ty = ij.y() >> TILE_BITS;
+            if (tx < m_tx0 || tx >= m_tx0 + m_ntx || ty < m_ty0 || ty >= m_ty0 + m_nty) {
+                // Grow the directory to include the new tile, with some slack in the direction of growth
+                const int slack = 4;
+                int tx0 = m_ntx == 0 ? tx : std::min(m_tx0, tx - slack);
+                int ty0 = m_nty == 0 ? ty : std::min(m_ty0, ty - slack);
+                int tx1 = m_ntx == 0 ? tx + 1 : std::max(m_tx0 + m_ntx, tx + 1 + slack);
+                int ty1 = m_nty == 0 ? ty + 1 : std::max(m_ty0 + m_nty, ty + 1 + slack);
+                std::vector<std::unique_ptr<Tile>> tiles((tx1 - tx0) * (ty1 - ty0));
+                for (int y = 0; y < m_nty; y++) {
+                    for (int x = 0; x < m_ntx; x++)
+                        tiles[(m_ty0 + y - ty0) * (tx1 - tx0) + (m_tx0 + x - tx0)] = std::move(m_tiles[y * m_ntx + x]);
+                }
+                m_tiles = std::move(tiles);
+                m_tx0 = tx0;
+                m_ty0 = ty0;
+                m_ntx = tx1 - tx0;
+                m_nty = ty1 - ty0;
+            }
+            auto& tile = m_tiles[(ty - m_ty0) * m_ntx + (tx - m_tx0)];
+            if (!tile)
+                tile = std::unique_ptr<Tile>(new Tile);
+            return *tile;
+        }
+
+        std::vector<std::unique_ptr<Tile>> m_tiles;  // tile directory (row-major, nullptr for unallocated tiles)
+        int m_tx0, m_ty0;                            // tile coordinates of first directory entry
+        int m_ntx, m_nty;                            // directory dimensions (number of tiles in X and Y directions)
+        size_t m_size;                               // number of nodes with a value set
+    };
+
+    // Soil state at a coarse grid node (multiresolution mode)
+    struct CoarseRecord {
+        double deformation;      // level change relative to the undeformed terrain
+        double sinkage_plastic;  // average plastic sinkage of the released nodes (along local normal direction)
+        double sigma_yield;      // average yield stress of the released nodes (along local normal direction)
+
+        CoarseRecord() : deformation(0), sinkage_plastic(0), sigma_yield(0) {}
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -413,6 +648,14 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Get the initial undeformed terrain normal (relative to the SCM plane) at the specified grid node.
     ChVector<> GetInitNormal(const ChVector2<int>& loc) const;
 
+    // Get the level (relative to the SCM plane) of a grid node without a node record. This is the initial undeformed
+    // height plus the deformation interpolated from the coarse grid (multiresolution mode).
+    double GetBaseHeight(const ChVector2<int>& loc) const;
+
+    // Create the record of a grid node without a node record, at its base height. In multiresolution mode, the plastic
+    // sinkage and yield stress are interpolated from the coarse grid.
+    NodeRecord CreateNodeRecord(const ChVector2<int>& loc) const;
+
     // Get the terrain height (relative to the SCM plane) at the specified grid node.
     double GetHeight(const ChVector2<int>& loc) const;
 
@@ -482,6 +725,17 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         ChLoadContainer::IntLoadResidual_F(off, R, c);
     }
 
+    // Transfer the deformation at grid nodes far from all patches to the coarse grid and release their node records
+    // (multiresolution mode).
+    void CoarsenGrid();
+
+    // Mark the specified grid node as changed over the current step (for visualization and delta output).
+    void MarkDirtyNode(const ChVector2<int>& ij, bool level_changed);
+
+    // Update the visualization mesh at the grid nodes changed over the current step and write the changed levels to
+    // the delta output. Indices of modified mesh vertices are appended to the given list.
+    void ProcessDirtyNodes(std::vector<int>& modified_vertices);
+
     // Add specified amount of material (possibly clamped) to node.
     void AddMaterialToNode(double amount, NodeRecord& nr);
 
@@ -512,17 +766,28 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
 
     ChMatrixDynamic<> m_heights;  // (base) grid heights (when initializing from height-field map)
 
-    std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_grid_map;  // modified grid nodes (persistent)
-    std::vector<ChVector2<int>> m_modified_nodes;                          // modified grid nodes (current)
+    TiledGrid<NodeRecord> m_grid_map;              // modified grid nodes (persistent)
+    TiledGrid<int> m_hit_ids;                      // index of ray hit at grid nodes (current step)
+    std::vector<ChVector2<int>> m_modified_nodes;  // modified grid nodes (current)
+    TiledGrid<CoarseRecord> m_coarse_map;          // soil state at coarse grid nodes (multiresolution mode)
+    TiledGrid<char> m_dirty_map;                   // grid nodes changed over current step (1: color, 2: level)
 
     std::vector<MovingPatchInfo> m_patches;  // set of active moving patches
     bool m_moving_patch;                     // user-specified moving patches?
+    bool m_patch_ray_casting;                // ray casting against patch bodies only?
+
+    bool m_multires;               // multiresolution mode?
+    int m_coarsening_factor;       // ratio of coarse to fine grid spacing
+    double m_coarsening_distance;  // distance from patches beyond which grid nodes are coarsened
 
     double m_test_offset_down;  // offset for ray start
     double m_test_offset_up;    // offset for ray end
 
     std::shared_ptr<ChTriangleMeshShape> m_trimesh_shape;  // mesh visualization asset
 
+    std::ofstream m_delta_stream;  // binary output of the changed grid nodes at each step
+    bool m_delta_header;           // header of delta output written?
+
     // SCM parameters
     double m_Bekker_Kphi;    ///< frictional modulus in Bekker model
     double m_Bekker_Kc;      ///< cohesive modulus in Bekker model
@@ -564,11 +829,13 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     ChTimer m_timer_bulldozing_boundary;
     ChTimer m_timer_bulldozing_domain;
     ChTimer m_timer_bulldozing_erosion;
+    ChTimer m_timer_coarsening;
     ChTimer m_timer_visualization;
     int m_num_ray_casts;
     int m_num_ray_hits;
     int m_num_contact_patches;
     int m_num_erosion_nodes;
+    int m_num_coarsened_nodes;
 
     friend class SCMTerrain;
 };
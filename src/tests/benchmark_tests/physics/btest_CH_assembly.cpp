@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Benchmark test for the parallel assembly update and state gather/scatter
+// functions, for an increasing number of Chrono threads.
+//
+// =============================================================================
+
+#include <random>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChBenchmark.h"
+
+using namespace chrono;
+
+// Benchmarking fixture: create system with a long chain of bodies connected by revolute joints.
+// The number of Chrono threads is the benchmark argument.
+
+class AssemblyBM : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        const int N = 20000;
+
+        sys = new ChSystemNSC();
+        sys->SetNumThreads((int)st.range(0));
+        sys->EnableParallelAssemblyUpdate(true);
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+        for (int i = 0; i < N + 1; i++) {
+            auto body = chrono_types::make_shared<ChBody>();
+            body->SetPos(ChVector<>(distribution(generator), distribution(generator), distribution(generator)));
+            body->SetWvel_loc(ChVector<>(0, 0, 1));
+            sys->AddBody(body);
+        }
+        for (int i = 0; i < N; i++) {
+            auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+            auto b1 = sys->Get_bodylist()[i];
+            auto b2 = sys->Get_bodylist()[i + 1];
+            auto loc = 0.5 * (b1->GetPos() + b2->GetPos());
+            joint->Initialize(b1, b2, ChCoordsys<>(loc, QUNIT));
+            sys->AddLink(joint);
+        }
+
+        sys->Setup();
+        sys->Update(false);
+
+        x = ChState(sys->GetNcoords_x(), sys);
+        v = ChStateDelta(sys->GetNcoords_v(), sys);
+        R = ChVectorDynamic<>(sys->GetNcoords_v());
+        sys->StateGather(x, v, T);
+    }
+
+    void TearDown(const ::benchmark::State&) override { delete sys; }
+
+    ChSystemNSC* sys;
+    ChState x;
+    ChStateDelta v;
+    ChVectorDynamic<> R;
+    double T;
+};
+
+// Benchmark assembly operations
+
+BENCHMARK_DEFINE_F(AssemblyBM, Update)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->Update(false);
+    }
+    st.SetItemsProcessed(st.iterations() * (sys->Get_bodylist().size() + sys->Get_linklist().size()));
+}
+
+BENCHMARK_DEFINE_F(AssemblyBM, StateGather)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->StateGather(x, v, T);
+    }
+    st.SetItemsProcessed(st.iterations() * (sys->Get_bodylist().size() + sys->Get_linklist().size()));
+}
+
+BENCHMARK_DEFINE_F(AssemblyBM, StateScatter)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->StateScatter(x, v, T, false);
+    }
+    st.SetItemsProcessed(st.iterations() * (sys->Get_bodylist().size() + sys->Get_linklist().size()));
+}
+
+BENCHMARK_DEFINE_F(AssemblyBM, LoadResidual_F)(benchmark::State& st) {
+    for (auto _ : st) {
+        R.setZero();
+        sys->LoadResidual_F(R, 1.0);
+    }
+    st.SetItemsProcessed(st.iterations() * (sys->Get_bodylist().size() + sys->Get_linklist().size()));
+}
+
+#define BM_ASSEMBLY_REGISTER(TEST_NAME) \
+    BENCHMARK_REGISTER_F(AssemblyBM, TEST_NAME)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMicrosecond);
+
+BM_ASSEMBLY_REGISTER(Update)
+BM_ASSEMBLY_REGISTER(StateGather)
+BM_ASSEMBLY_REGISTER(StateScatter)
+BM_ASSEMBLY_REGISTER(LoadResidual_F)
+
+// Main function
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Common utility functions for collision tests comparing the contacts of two
+// systems
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct ContactData {
+    int bodyA;
+    int bodyB;
+    ChVector<> pA;
+    ChVector<> pB;
+    ChVector<> normal;
+    double distance;
+};
+
+// Record all contacts between bodies, ordered so that the first body has the smaller ID.
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        int idA = (int)dynamic_cast<ChBody*>(contactobjA)->GetId();
+        int idB = (int)dynamic_cast<ChBody*>(contactobjB)->GetId();
+        ChVector<> normal = plane_coord.Get_A_Xaxis();
+        if (idA < idB)
+            contacts.push_back({idA, idB, pA, pB, normal, distance});
+        else
+            contacts.push_back({idB, idA, pB, pA, -normal, distance});
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+// Collect the contacts of the given system, sorted by body pair and position.
+std::vector<ContactData> GetContacts(ChSystem& sys) {
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    auto& contacts = collector->contacts;
+    std::sort(contacts.begin(), contacts.end(), [](const ContactData& c1, const ContactData& c2) {
+        if (c1.bodyA != c2.bodyA)
+            return c1.bodyA < c2.bodyA;
+        if (c1.bodyB != c2.bodyB)
+            return c1.bodyB < c2.bodyB;
+        if (c1.pA.x() != c2.pA.x())
+            return c1.pA.x() < c2.pA.x();
+        if (c1.pA.y() != c2.pA.y())
+            return c1.pA.y() < c2.pA.y();
+        return c1.pA.z() < c2.pA.z();
+    });
+    return contacts;
+}
+
+// Check that two lists of contacts (see GetContacts) are the same, up to the given tolerance.
+void CompareContacts(const std::vector<ContactData>& c1, const std::vector<ContactData>& c2, double tol) {
+    ASSERT_EQ(c1.size(), c2.size());
+    for (size_t i = 0; i < c1.size(); i++) {
+        ASSERT_EQ(c1[i].bodyA, c2[i].bodyA);
+        ASSERT_EQ(c1[i].bodyB, c2[i].bodyB);
+        ASSERT_NEAR((c1[i].pA - c2[i].pA).Length(), 0.0, tol);
+        ASSERT_NEAR((c1[i].pB - c2[i].pB).Length(), 0.0, tol);
+        ASSERT_NEAR((c1[i].normal - c2[i].normal).Length(), 0.0, tol);
+        ASSERT_NEAR(c1[i].distance, c2[i].distance, tol);
+    }
+}
+
+// Copy the states of all bodies from one system to the other.
+void CopyState(ChSystem& from, ChSystem& to) {
+    const auto& bodies_from = from.Get_bodylist();
+    const auto& bodies_to = to.Get_bodylist();
+    for (size_t i = 0; i < bodies_from.size(); i++) {
+        bodies_to[i]->SetCoord(bodies_from[i]->GetCoord());
+        bodies_to[i]->SetPos_dt(bodies_from[i]->GetPos_dt());
+        bodies_to[i]->SetWvel_par(bodies_from[i]->GetWvel_par());
+    }
+}
@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit tests for the BVH broadphase of the Chrono collision system.
+// The contacts generated with the BVH broadphase are compared to those found
+// with the grid broadphase, for the same body configurations.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// -----------------------------------------------------------------------------
+
+// Create a container with a mix of small and large spheres and boxes, with random initial positions.
+static void CreateScene(ChSystemNSC& sys, bool use_bvh) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetEnvelope(0.01);
+    if (use_bvh)
+        collsys->SetBroadphaseBVH();
+    else
+        collsys->SetBroadphaseGridResolution(ChVector<int>(8, 8, 4));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto container = std::shared_ptr<ChBody>(sys.NewBody());
+    container->SetBodyFixed(true);
+    container->SetCollide(true);
+    container->GetCollisionModel()->ClearModel();
+    utils::AddBoxContainer(container, mat, ChFrame<>(), ChVector<>(4, 4, 4), 0.2, ChVector<int>(2, 2, -1), false);
+    container->GetCollisionModel()->BuildModel();
+    sys.AddBody(container);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.6, 1.6);
+    for (int i = 0; i < 60; i++) {
+        double size = (i % 10 == 0) ? 0.3 : 0.08;
+        auto body = std::shared_ptr<ChBody>(sys.NewBody());
+        body->SetMass(1);
+        body->SetInertiaXX(ChVector<>(0.01, 0.01, 0.01));
+        body->SetPos(ChVector<>(distribution(generator), distribution(generator), 1.0 + 0.05 * i));
+        body->SetCollide(true);
+        body->GetCollisionModel()->ClearModel();
+        if (i % 2 == 0)
+            utils::AddSphereGeometry(body.get(), mat, size);
+        else
+            utils::AddBoxGeometry(body.get(), mat, ChVector<>(size, size, size));
+        body->GetCollisionModel()->BuildModel();
+        sys.AddBody(body);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Let the bodies fall and pile up; at each step, the BVH system starts from the state of the grid system and must find
+// the same contacts. This exercises both the refit and the rebuild of the hierarchy.
+TEST(ChBroadphaseBVH, compare_grid) {
+    ChSystemNSC sys_grid;
+    ChSystemNSC sys_bvh;
+    CreateScene(sys_grid, false);
+    CreateScene(sys_bvh, true);
+
+    int num_contacts = 0;
+    for (int step = 0; step < 500; step++) {
+        CopyState(sys_grid, sys_bvh);
+        sys_grid.DoStepDynamics(2e-3);
+        sys_bvh.DoStepDynamics(2e-3);
+
+        auto contacts_grid = GetContacts(sys_grid);
+        ASSERT_NO_FATAL_FAILURE(CompareContacts(contacts_grid, GetContacts(sys_bvh), 1e-10));
+        num_contacts = (int)contacts_grid.size();
+    }
+
+    // Most bodies reached the bottom of the container
+    ASSERT_GT(num_contacts, 40);
+}
+
+// Ray casting with the BVH broadphase.
+TEST(ChBroadphaseBVH, ray_hit) {
+    ChSystemNSC sys_grid;
+    ChSystemNSC sys_bvh;
+    CreateScene(sys_grid, false);
+    CreateScene(sys_bvh, true);
+
+    sys_grid.DoStepDynamics(2e-3);
+    sys_bvh.DoStepDynamics(2e-3);
+
+    for (int i = 0; i < 10; i++) {
+        ChVector<> from(-1.5 + 0.3 * i, 0.1 * i, 5);
+        ChVector<> to(from.x(), from.y(), -1);
+        ChCollisionSystem::ChRayhitResult result_grid;
+        ChCollisionSystem::ChRayhitResult result_bvh;
+        ASSERT_TRUE(sys_grid.GetCollisionSystem()->RayHit(from, to, result_grid));
+        ASSERT_TRUE(sys_bvh.GetCollisionSystem()->RayHit(from, to, result_bvh));
+        ASSERT_NEAR(result_grid.dist_factor, result_bvh.dist_factor, 1e-12);
+        ASSERT_EQ(dynamic_cast<ChBody*>(result_grid.hitModel->GetContactable())->GetId(),
+                  dynamic_cast<ChBody*>(result_bvh.hitModel->GetContactable())->GetId());
+    }
+}
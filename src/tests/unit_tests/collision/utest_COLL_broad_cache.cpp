@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit tests for the broadphase cache of the Chrono collision system.
+// The contacts generated with the broadphase cache enabled are compared to those
+// found without caching, for the same body configurations, including after a
+// fixed body is moved explicitly.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// -----------------------------------------------------------------------------
+
+// Create a container with a mix of small and large spheres and boxes, with random initial positions. If enabled, the
+// active box only contains part of the container, so that some of the bodies are not processed.
+static void CreateScene(ChSystemNSC& sys, bool use_bvh, bool use_active_box, bool use_cache) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetEnvelope(0.01);
+    if (use_bvh)
+        collsys->SetBroadphaseBVH();
+    else
+        collsys->SetBroadphaseGridResolution(ChVector<int>(8, 8, 4));
+    if (use_active_box)
+        collsys->EnableActiveBoundingBox(ChVector<>(-3, -3, -3), ChVector<>(3, 0.5, 5));
+    collsys->EnableBroadphaseCache(use_cache);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto container = std::shared_ptr<ChBody>(sys.NewBody());
+    container->SetBodyFixed(true);
+    container->SetCollide(true);
+    container->GetCollisionModel()->ClearModel();
+    utils::AddBoxContainer(container, mat, ChFrame<>(), ChVector<>(4, 4, 4), 0.2, ChVector<int>(2, 2, -1), false);
+    container->GetCollisionModel()->BuildModel();
+    sys.AddBody(container);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.6, 1.6);
+    for (int i = 0; i < 60; i++) {
+        double size = (i % 10 == 0) ? 0.3 : 0.08;
+        auto body = std::shared_ptr<ChBody>(sys.NewBody());
+        body->SetMass(1);
+        body->SetInertiaXX(ChVector<>(0.01, 0.01, 0.01));
+        body->SetPos(ChVector<>(distribution(generator), distribution(generator), 1.0 + 0.05 * i));
+        body->SetCollide(true);
+        body->GetCollisionModel()->ClearModel();
+        if (i % 2 == 0)
+            utils::AddSphereGeometry(body.get(), mat, size);
+        else
+            utils::AddBoxGeometry(body.get(), mat, ChVector<>(size, size, size));
+        body->GetCollisionModel()->BuildModel();
+        sys.AddBody(body);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+class BroadphaseCacheTest : public ::testing::TestWithParam<std::tuple<bool, bool>> {};
+
+// Let the bodies fall and pile up in the fixed container; at each step, the system using the broadphase cache starts
+// from the state of the reference system and must find the same contacts. Halfway through, the fixed container is
+// moved explicitly, which must invalidate its cached AABBs.
+TEST_P(BroadphaseCacheTest, compare) {
+    bool use_bvh = std::get<0>(GetParam());
+    bool use_active_box = std::get<1>(GetParam());
+
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_cache;
+    CreateScene(sys_ref, use_bvh, use_active_box, false);
+    CreateScene(sys_cache, use_bvh, use_active_box, true);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys_cache.GetCollisionSystem());
+
+    double aabb_hit_rate = 0;
+    double bin_hit_rate = 0;
+    for (int step = 0; step < 400; step++) {
+        if (step == 200) {
+            sys_ref.Get_bodylist()[0]->SetPos(ChVector<>(0.05, 0, 0));
+            sys_cache.Get_bodylist()[0]->SetPos(ChVector<>(0.05, 0, 0));
+        }
+
+        CopyState(sys_ref, sys_cache);
+        sys_ref.DoStepDynamics(2e-3);
+        sys_cache.DoStepDynamics(2e-3);
+        ASSERT_NO_FATAL_FAILURE(CompareContacts(GetContacts(sys_cache), GetContacts(sys_ref), 1e-12));
+
+        aabb_hit_rate = std::max(aabb_hit_rate, collsys->GetAABBCacheHitRate());
+        bin_hit_rate = std::max(bin_hit_rate, collsys->GetBinCacheHitRate());
+    }
+
+    // The shapes of the fixed container were reused
+    ASSERT_GT(aabb_hit_rate, 0.0);
+    if (!use_bvh)
+        ASSERT_GT(bin_hit_rate, 0.0);
+    ASSERT_GT(sys_cache.GetNcontacts(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChCollisionSystemChrono,
+                         BroadphaseCacheTest,
+                         ::testing::Combine(::testing::Bool(), ::testing::Bool()));
@@ -0,0 +1,177 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit tests for the contact reduction of the Chrono collision system.
+// A box resting on a finely tessellated triangle mesh generates many contacts;
+// with contact reduction enabled, the number of contacts per normal cluster is
+// limited and the box must still rest on the mesh.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/geometry/ChTriangleMeshSoup.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// -----------------------------------------------------------------------------
+
+class NormalCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        normals.push_back(plane_coord.Get_A_Xaxis());
+        return true;
+    }
+
+    std::vector<ChVector<>> normals;
+};
+
+// Return the number of contacts in the given system with normal within 15 degrees of the given direction (in either
+// sense). Besides the contacts with normals along the face normals of the mesh, triangles crossing the boundary of a
+// box face also generate contacts with slanted normals, which belong to other clusters.
+static int CountContacts(ChSystem& sys, const ChVector<>& dir) {
+    auto collector = chrono_types::make_shared<NormalCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    int count = 0;
+    for (const auto& n : collector->normals) {
+        if (std::abs(n ^ dir) > std::cos(CH_C_PI / 12))
+            count++;
+    }
+    return count;
+}
+
+// Add to the mesh a square grid of n x n cells with the given size, in the plane through 'origin' spanned by 'u' and
+// 'v' (with normal u x v).
+static void AddGrid(geometry::ChTriangleMeshSoup& mesh,
+                    const ChVector<>& origin,
+                    const ChVector<>& u,
+                    const ChVector<>& v,
+                    int n,
+                    double size) {
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ChVector<> p00 = origin + u * (i * size) + v * (j * size);
+            ChVector<> p10 = p00 + u * size;
+            ChVector<> p01 = p00 + v * size;
+            ChVector<> p11 = p10 + v * size;
+            mesh.addTriangle(p00, p10, p11);
+            mesh.addTriangle(p00, p11, p01);
+        }
+    }
+}
+
+// Create a fixed mesh floor (at z = 0, spanning [-2,2] x [-2,2]) and, optionally, a mesh wall (at x = 0.505), and a
+// unit box just above the floor (and next to the wall), within the collision envelope.
+// Note that the faces of the box are placed slightly away from the mesh since the contact normals of coplanar faces
+// overlapping a triangle edge are not well defined.
+static std::shared_ptr<ChBody> CreateScene(ChSystemNSC& sys, bool wall, bool reduction, int max_contacts) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetSolverMaxIterations(100);
+
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetEnvelope(0.01);
+    collsys->EnableContactReduction(reduction, max_contacts);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    auto mesh = chrono_types::make_shared<geometry::ChTriangleMeshSoup>();
+    AddGrid(*mesh, ChVector<>(-2, -2, 0), ChVector<>(1, 0, 0), ChVector<>(0, 1, 0), 40, 0.1);
+    if (wall)
+        AddGrid(*mesh, ChVector<>(0.505, -2, 0), ChVector<>(0, 1, 0), ChVector<>(0, 0, 1), 40, 0.1);
+
+    auto ground = std::shared_ptr<ChBody>(sys.NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddTriangleMesh(mat, mesh, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    auto box = std::shared_ptr<ChBody>(sys.NewBody());
+    box->SetMass(10);
+    box->SetInertiaXX(ChVector<>(1, 1, 1));
+    box->SetPos(ChVector<>(0, 0, 0.505));
+    box->SetCollide(true);
+    box->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(box.get(), mat, ChVector<>(0.5, 0.5, 0.5));
+    box->GetCollisionModel()->BuildModel();
+    sys.AddBody(box);
+
+    return box;
+}
+
+// -----------------------------------------------------------------------------
+
+// The number of contacts between the box and the floor is limited to the maximum number of contacts per cluster, and
+// all removed contacts are reported.
+TEST(ChCollisionSystemChrono, reduction_count) {
+    ChSystemNSC sys_full;
+    CreateScene(sys_full, false, false, 4);
+    sys_full.DoStepDynamics(1e-3);
+    int num_full = sys_full.GetNcontacts();
+    ASSERT_GT(CountContacts(sys_full, VECT_Z), 8);
+
+    for (int max_contacts : {1, 3, 4, 8}) {
+        ChSystemNSC sys;
+        CreateScene(sys, false, true, max_contacts);
+        sys.DoStepDynamics(1e-3);
+        auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+        ASSERT_EQ(CountContacts(sys, VECT_Z), max_contacts);
+        ASSERT_LT(sys.GetNcontacts(), num_full);
+        ASSERT_EQ((int)collsys->GetNumReducedContacts(), num_full - sys.GetNcontacts());
+    }
+}
+
+// Contacts between the box and the floor, and between the box and the wall, belong to different normal clusters of
+// the same body pair; each cluster keeps its own representative contacts.
+TEST(ChCollisionSystemChrono, reduction_clusters) {
+    ChSystemNSC sys;
+    CreateScene(sys, true, true, 4);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(CountContacts(sys, VECT_Z), 4);
+    ASSERT_EQ(CountContacts(sys, VECT_X), 4);
+}
+
+// With the reduced contacts, the box falls on the floor and remains at rest.
+TEST(ChCollisionSystemChrono, reduction_resting) {
+    ChSystemNSC sys;
+    auto box = CreateScene(sys, false, true, 4);
+    for (int step = 0; step < 500; step++) {
+        sys.DoStepDynamics(1e-3);
+        ASSERT_EQ(CountContacts(sys, VECT_Z), 4);
+    }
+
+    ASSERT_NEAR(box->GetPos().x(), 0.0, 1e-4);
+    ASSERT_NEAR(box->GetPos().y(), 0.0, 1e-4);
+    ASSERT_NEAR(box->GetPos().z(), 0.5, 1e-3);
+    ASSERT_NEAR(box->GetPos_dt().Length(), 0.0, 1e-3);
+    ASSERT_NEAR(box->GetWvel_par().Length(), 0.0, 1e-3);
+}
@@ -0,0 +1,185 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit tests for triangle mesh collision shapes in the Chrono collision system.
+// - the triangles found by the mesh BVH are compared to a brute force search
+// - ray casting against a mesh placed in a rotated body frame
+// - a sphere dropped on a mesh comes to rest on its surface
+//
+// =============================================================================
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/collision/chrono/ChTriangleMeshBVH.h"
+#include "chrono/geometry/ChTriangleMeshSoup.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// -----------------------------------------------------------------------------
+
+// Create a fixed body at the given frame, with a square mesh of n x n cells with the given size, in the x-y plane of
+// the body frame and centered at its origin.
+static std::shared_ptr<ChBody> CreateMeshGround(ChSystemNSC& sys, const ChFrame<>& frame, int n, double size) {
+    auto mesh = chrono_types::make_shared<geometry::ChTriangleMeshSoup>();
+    double offset = -0.5 * n * size;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ChVector<> p00(offset + i * size, offset + j * size, 0);
+            ChVector<> p10 = p00 + ChVector<>(size, 0, 0);
+            ChVector<> p01 = p00 + ChVector<>(0, size, 0);
+            ChVector<> p11 = p00 + ChVector<>(size, size, 0);
+            mesh->addTriangle(p00, p10, p11);
+            mesh->addTriangle(p00, p11, p01);
+        }
+    }
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = std::shared_ptr<ChBody>(sys.NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCoord(frame.GetCoord());
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddTriangleMesh(mat, mesh, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    return ground;
+}
+
+static void InitializeSystem(ChSystemNSC& sys) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetEnvelope(0.01);
+}
+
+// -----------------------------------------------------------------------------
+
+// The triangles with AABB overlapping a query box are the same as those found by checking all triangles.
+TEST(ChTriangleMeshBVH, overlaps) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<real> position(0, 10);
+    std::uniform_real_distribution<real> offset(-0.3, 0.3);
+
+    std::vector<real3> vertices;
+    for (int i = 0; i < 1000; i++) {
+        real3 center(position(generator), position(generator), position(generator));
+        for (int k = 0; k < 3; k++)
+            vertices.push_back(center + real3(offset(generator), offset(generator), offset(generator)));
+    }
+
+    ChTriangleMeshBVH bvh(vertices);
+    ASSERT_EQ(bvh.GetNumTriangles(), 1000);
+
+    // Triangles are reordered but not modified
+    real3 sum_in(0);
+    real3 sum_bvh(0);
+    for (int i = 0; i < 3000; i++) {
+        sum_in += vertices[i];
+        sum_bvh += bvh.GetTriangle(i / 3)[i % 3];
+    }
+    ASSERT_NEAR(Length(sum_in - sum_bvh), 0.0, 1e-9);
+
+    for (int q = 0; q < 200; q++) {
+        real3 center(position(generator), position(generator), position(generator));
+        real3 half(0.1 + 0.1 * (q % 10));
+        real3 qmin = center - half;
+        real3 qmax = center + half;
+
+        std::vector<int> found;
+        bvh.FindOverlaps(qmin, qmax, found);
+        std::sort(found.begin(), found.end());
+
+        std::vector<int> expected;
+        for (int i = 0; i < bvh.GetNumTriangles(); i++) {
+            const real3* tri = bvh.GetTriangle(i);
+            real3 tmin = Min(tri[0], Min(tri[1], tri[2]));
+            real3 tmax = Max(tri[0], Max(tri[1], tri[2]));
+            if (tmin.x <= qmax.x && qmin.x <= tmax.x && tmin.y <= qmax.y && qmin.y <= tmax.y && tmin.z <= qmax.z &&
+                qmin.z <= tmax.z)
+                expected.push_back(i);
+        }
+
+        ASSERT_EQ(found, expected);
+    }
+}
+
+// Rays cast along the normal of a mesh plane placed in a rotated body frame hit the plane at the expected points.
+TEST(ChCollisionSystemChrono, mesh_ray_hit) {
+    ChSystemNSC sys;
+    InitializeSystem(sys);
+
+    ChFrame<> frame(ChVector<>(1, 2, 0.5), Q_from_AngX(0.3) * Q_from_AngZ(0.2));
+    auto ground = CreateMeshGround(sys, frame, 40, 0.1);
+    sys.DoStepDynamics(1e-3);
+
+    ChVector<> normal = frame.TransformDirectionLocalToParent(VECT_Z);
+    for (int i = 0; i < 20; i++) {
+        ChVector<> target = frame.TransformPointLocalToParent(ChVector<>(-1.9 + 0.19 * i, 1.7 - 0.17 * i, 0));
+        ChCollisionSystem::ChRayhitResult result;
+        ASSERT_TRUE(sys.GetCollisionSystem()->RayHit(target + normal, target - normal, result));
+        ASSERT_EQ(result.hitModel, ground->GetCollisionModel().get());
+        ASSERT_NEAR((result.abs_hitPoint - target).Length(), 0.0, 1e-9);
+        ASSERT_NEAR(result.dist_factor, 0.5, 1e-9);
+        ASSERT_NEAR(std::abs(result.abs_hitNormal ^ normal), 1.0, 1e-9);
+    }
+
+    // Rays outside the mesh
+    ChVector<> target = frame.TransformPointLocalToParent(ChVector<>(2.1, 0, 0));
+    ChCollisionSystem::ChRayhitResult result;
+    ASSERT_FALSE(sys.GetCollisionSystem()->RayHit(target + normal, target - normal, result));
+    target = frame.TransformPointLocalToParent(ChVector<>(0, 0, 0.5));
+    ASSERT_FALSE(sys.GetCollisionSystem()->RayHit(target + normal, target, result));
+}
+
+// A sphere dropped on a mesh plane comes to rest on its surface. The sphere lands close to a triangle vertex, so that
+// it collides with several triangles.
+TEST(ChCollisionSystemChrono, mesh_rest) {
+    ChSystemNSC sys;
+    InitializeSystem(sys);
+    CreateMeshGround(sys, ChFrame<>(), 40, 0.1);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    auto sphere = std::shared_ptr<ChBody>(sys.NewBody());
+    sphere->SetMass(1);
+    sphere->SetInertiaXX(ChVector<>(0.016, 0.016, 0.016));
+    sphere->SetPos(ChVector<>(-0.901, 0.399, 0.205));
+    sphere->SetCollide(true);
+    sphere->GetCollisionModel()->ClearModel();
+    utils::AddSphereGeometry(sphere.get(), mat, 0.2);
+    sphere->GetCollisionModel()->BuildModel();
+    sys.AddBody(sphere);
+
+    while (sys.GetChTime() < 1) {
+        sys.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_GT(sys.GetNcontacts(), 1);
+    ASSERT_NEAR(sphere->GetPos().x(), -0.901, 1e-3);
+    ASSERT_NEAR(sphere->GetPos().y(), 0.399, 1e-3);
+    ASSERT_NEAR(sphere->GetPos().z(), 0.2, 1e-4);
+    ASSERT_NEAR(sphere->GetPos_dt().Length(), 0.0, 1e-3);
+}
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit tests for the narrowphase pair cache of the Chrono collision system.
+// The contacts generated with the cache enabled are compared to those of an
+// identical system without the cache.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// -----------------------------------------------------------------------------
+
+// Create a system with a fixed ground, a few resting boxes, and a few falling spheres.
+static void CreateScene(ChSystemNSC& sys, bool use_cache, double gravity) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    sys.Set_G_acc(ChVector<>(0, 0, -gravity));
+
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetEnvelope(0.01);
+    collsys->SetBroadphaseGridResolution(ChVector<int>(4, 4, 1));
+    collsys->EnableNarrowphaseCache(use_cache, 0);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = std::shared_ptr<ChBody>(sys.NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(4, 4, 0.1), ChVector<>(0, 0, -0.1));
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            auto box = std::shared_ptr<ChBody>(sys.NewBody());
+            box->SetMass(1);
+            box->SetPos(ChVector<>(-1.0 + i, -1.0 + j, 0.25 + 0.005 * j));
+            box->SetCollide(true);
+            box->GetCollisionModel()->ClearModel();
+            utils::AddBoxGeometry(box.get(), mat, ChVector<>(0.25, 0.25, 0.25));
+            box->GetCollisionModel()->BuildModel();
+            sys.AddBody(box);
+
+            auto ball = std::shared_ptr<ChBody>(sys.NewBody());
+            ball->SetMass(1);
+            ball->SetPos(ChVector<>(-1.0 + i + 0.1, -1.0 + j, 0.8 + 0.1 * i));
+            ball->SetCollide(true);
+            ball->GetCollisionModel()->ClearModel();
+            utils::AddSphereGeometry(ball.get(), mat, 0.15);
+            ball->GetCollisionModel()->BuildModel();
+            sys.AddBody(ball);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// With a zero tolerance, cached contacts are reused only for unchanged relative poses, so the simulation with the
+// cache must reproduce the one without it.
+TEST(ChNarrowphaseCache, dynamic) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_cache;
+    CreateScene(sys_ref, false, 9.81);
+    CreateScene(sys_cache, true, 9.81);
+
+    for (int step = 0; step < 300; step++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_cache.DoStepDynamics(1e-3);
+        ASSERT_NO_FATAL_FAILURE(CompareContacts(GetContacts(sys_ref), GetContacts(sys_cache), 1e-10));
+    }
+
+    for (size_t i = 0; i < sys_ref.Get_bodylist().size(); i++) {
+        auto pos_ref = sys_ref.Get_bodylist()[i]->GetPos();
+        auto pos_cache = sys_cache.Get_bodylist()[i]->GetPos();
+        ASSERT_NEAR((pos_ref - pos_cache).Length(), 0.0, 1e-10);
+    }
+}
+
+// Without gravity, the bodies stay in place and the cached contacts are reused.
+TEST(ChNarrowphaseCache, static_scene) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_cache;
+    CreateScene(sys_ref, false, 0);
+    CreateScene(sys_cache, true, 0);
+
+    for (int step = 0; step < 10; step++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_cache.DoStepDynamics(1e-3);
+        ASSERT_NO_FATAL_FAILURE(CompareContacts(GetContacts(sys_ref), GetContacts(sys_cache), 1e-10));
+    }
+
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys_cache.GetCollisionSystem());
+    ASSERT_GT(collsys->GetNarrowphaseCacheHitRate(), 0.0);
+}
+
+// Changing the collision envelope must invalidate the cached contacts.
+TEST(ChNarrowphaseCache, envelope_change) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_cache;
+    CreateScene(sys_ref, false, 0);
+    CreateScene(sys_cache, true, 0);
+
+    for (int step = 0; step < 5; step++)
+        sys_cache.DoStepDynamics(1e-3);
+
+    std::static_pointer_cast<ChCollisionSystemChrono>(sys_ref.GetCollisionSystem())->SetEnvelope(0.002);
+    std::static_pointer_cast<ChCollisionSystemChrono>(sys_cache.GetCollisionSystem())->SetEnvelope(0.002);
+
+    sys_ref.DoStepDynamics(1e-3);
+    sys_cache.DoStepDynamics(1e-3);
+    ASSERT_NO_FATAL_FAILURE(CompareContacts(GetContacts(sys_ref), GetContacts(sys_cache), 1e-10));
+}
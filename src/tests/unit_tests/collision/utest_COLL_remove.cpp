@@ -0,0 +1,190 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit tests for the removal of bodies from a system using the Chrono collision
+// system. After removing colliding and non-colliding bodies, the contacts and
+// ray casting results must match those of a system created without them.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// -----------------------------------------------------------------------------
+
+// Create a system with a fixed ground and a row of bodies just above it (within the collision envelope), alternating
+// colliding spheres and non-colliding bodies. Bodies with index in the 'skip' list are not created.
+static void CreateScene(ChSystemNSC& sys, const std::vector<int>& skip) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    sys.Set_G_acc(ChVector<>(0, 0, 0));
+
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetEnvelope(0.01);
+    collsys->EnableBroadphaseCache(true);
+    collsys->EnableNarrowphaseCache(true, 0);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = std::shared_ptr<ChBody>(sys.NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(10, 1, 0.2), ChVector<>(0, 0, -0.2));
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 12; i++) {
+        if (std::find(skip.begin(), skip.end(), i) != skip.end())
+            continue;
+
+        auto body = std::shared_ptr<ChBody>(sys.NewBody());
+        body->SetMass(1);
+        body->SetPos(ChVector<>(-5.5 + i, 0, 0.2 + 0.005));
+        if (i % 2 == 0) {
+            body->SetCollide(true);
+            body->GetCollisionModel()->ClearModel();
+            utils::AddSphereGeometry(body.get(), mat, 0.2);
+            body->GetCollisionModel()->BuildModel();
+        } else {
+            body->SetCollide(false);
+        }
+        sys.AddBody(body);
+    }
+}
+
+static void CheckSystem(ChSystemNSC& sys, ChSystemNSC& sys_ref) {
+    const auto& blist = sys.Get_bodylist();
+    const auto& blist_ref = sys_ref.Get_bodylist();
+    ASSERT_EQ(blist.size(), blist_ref.size());
+    for (size_t i = 0; i < blist.size(); i++) {
+        ASSERT_EQ(blist[i]->GetId(), (unsigned int)i);
+        ASSERT_NEAR((blist[i]->GetPos() - blist_ref[i]->GetPos()).Length(), 0.0, 1e-12);
+    }
+
+    // Same contacts, between the same bodies
+    ASSERT_NO_FATAL_FAILURE(CompareContacts(GetContacts(sys), GetContacts(sys_ref), 1e-10));
+
+    // A vertical ray through each colliding body hits that body
+    for (const auto& body : blist) {
+        if (!body->GetCollide() || body->GetBodyFixed())
+            continue;
+        ChCollisionSystem::ChRayhitResult result;
+        ChVector<> pos = body->GetPos();
+        ASSERT_TRUE(sys.GetCollisionSystem()->RayHit(pos + ChVector<>(0, 0, 1), pos - ChVector<>(0, 0, 0.1), result));
+        ASSERT_EQ(result.hitModel, body->GetCollisionModel().get());
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Remove one colliding body and one non-colliding body.
+TEST(ChCollisionSystemChrono, remove_bodies) {
+    ChSystemNSC sys;
+    ChSystemNSC sys_ref;
+    CreateScene(sys, {});
+    CreateScene(sys_ref, {3, 4});
+
+    for (int step = 0; step < 3; step++) {
+        sys.DoStepDynamics(1e-3);
+        sys_ref.DoStepDynamics(1e-3);
+    }
+    ASSERT_EQ(sys.GetNcontacts(), 6);
+
+    // Body list indices are shifted by one because of the ground
+    auto body3 = sys.Get_bodylist()[4];
+    auto body4 = sys.Get_bodylist()[5];
+    sys.RemoveBody(body4);
+    sys.RemoveBody(body3);
+
+    for (int step = 0; step < 3; step++) {
+        sys.DoStepDynamics(1e-3);
+        sys_ref.DoStepDynamics(1e-3);
+    }
+    ASSERT_EQ(sys.GetNcontacts(), 5);
+    ASSERT_NO_FATAL_FAILURE(CheckSystem(sys, sys_ref));
+}
+
+// Remove only non-colliding bodies; the IDs of the colliding bodies following them change.
+TEST(ChCollisionSystemChrono, remove_noncolliding) {
+    ChSystemNSC sys;
+    ChSystemNSC sys_ref;
+    CreateScene(sys, {});
+    CreateScene(sys_ref, {1, 7});
+
+    for (int step = 0; step < 3; step++) {
+        sys.DoStepDynamics(1e-3);
+        sys_ref.DoStepDynamics(1e-3);
+    }
+
+    auto body1 = sys.Get_bodylist()[2];
+    auto body7 = sys.Get_bodylist()[8];
+    sys.RemoveBody(body1);
+    sys.RemoveBody(body7);
+
+    for (int step = 0; step < 3; step++) {
+        sys.DoStepDynamics(1e-3);
+        sys_ref.DoStepDynamics(1e-3);
+    }
+    ASSERT_EQ(sys.GetNcontacts(), 6);
+    ASSERT_NO_FATAL_FAILURE(CheckSystem(sys, sys_ref));
+}
+
+// Remove a non-colliding body and add a new colliding body before the next step.
+TEST(ChCollisionSystemChrono, remove_and_add) {
+    ChSystemNSC sys;
+    ChSystemNSC sys_ref;
+    CreateScene(sys, {});
+    CreateScene(sys_ref, {11});
+
+    for (int step = 0; step < 3; step++) {
+        sys.DoStepDynamics(1e-3);
+        sys_ref.DoStepDynamics(1e-3);
+    }
+
+    // Remove the last (non-colliding) body, then remove a non-colliding body in the middle of the row and add it back
+    // as a colliding sphere at the end of the body list, in both systems
+    sys.RemoveBody(sys.Get_bodylist()[12]);
+    auto body = sys.Get_bodylist()[6];
+    auto body_ref = sys_ref.Get_bodylist()[6];
+    sys.RemoveBody(body);
+    sys_ref.RemoveBody(body_ref);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    for (auto b : {body, body_ref}) {
+        b->SetCollide(true);
+        b->GetCollisionModel()->ClearModel();
+        utils::AddSphereGeometry(b.get(), mat, 0.2);
+        b->GetCollisionModel()->BuildModel();
+    }
+    sys.AddBody(body);
+    sys_ref.AddBody(body_ref);
+
+    for (int step = 0; step < 3; step++) {
+        sys.DoStepDynamics(1e-3);
+        sys_ref.DoStepDynamics(1e-3);
+    }
+    ASSERT_EQ(sys.GetNcontacts(), 7);
+    ASSERT_NO_FATAL_FAILURE(CheckSystem(sys, sys_ref));
+}
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the compiled constraint representation of iterative VI solvers.
+// The Schur complement product of ChCompiledConstraints is compared to that of
+// the system descriptor, and the velocities obtained with ChSolverPSOR and
+// ChSolverAPGD using compiled constraints are compared to those obtained with
+// the same solvers operating on the individual constraints, with and without
+// rolling and spinning friction.
+//
+// =============================================================================
+
+#include <tuple>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChCompiledConstraints.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+using namespace chrono;
+
+// Create a system with stacked spheres (frictional contacts) and pendulums (bilateral joints).
+// With rolling friction, the spheres are also given an initial angular velocity. In that case, fewer iterations are
+// performed since APGD does not converge with the rolling friction projection, and round-off differences between the
+// two implementations grow with the number of iterations.
+static void CreateSystem(ChSystemNSC& sys, ChSolver::Type solver_type, bool compiled, bool rolling) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetSolverType(solver_type);
+    sys.SetSolverMaxIterations(rolling ? 100 : 500);
+    sys.SetSolverTolerance(1e-12);
+    std::static_pointer_cast<ChIterativeSolverVI>(sys.GetSolver())->EnableCompiledConstraints(compiled);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.3f);
+    if (rolling) {
+        mat->SetRollingFriction(0.05f);
+        mat->SetSpinningFriction(0.05f);
+    }
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.5));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 3; i++) {
+        for (int k = 0; k < 3; k++) {
+            auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, true, true, mat);
+            ball->SetPos(ChVector<>(-2.0 + 2 * i, 0, 0.5 + k));
+            ball->SetPos_dt(ChVector<>(0.1 * i, 0, -0.1 * (k + 1)));
+            if (rolling)
+                ball->SetWvel_par(ChVector<>(1.0 * k, 0.5 * i, 2.0));
+            sys.AddBody(ball);
+        }
+    }
+
+    for (int i = 0; i < 2; i++) {
+        auto bob = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 1, 100, true, false);
+        bob->SetPos(ChVector<>(6, -1.0 + 2 * i, 4.5));
+        bob->SetPos_dt(ChVector<>(0, 0.5, 0));
+        sys.AddBody(bob);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(ground, bob, ChCoordsys<>(ChVector<>(6, -1.0 + 2 * i, 5), Q_from_AngY(CH_C_PI_2)));
+        sys.AddLink(joint);
+    }
+}
+
+TEST(ChCompiledConstraints, schur_product) {
+    ChSystemNSC sys;
+    CreateSystem(sys, ChSolver::Type::PSOR, false, true);
+    sys.DoStepDynamics(1e-2);
+
+    // After the solve, the auxiliary data of the constraints is up to date
+    auto& sysd = *sys.GetSystemDescriptor();
+    ChCompiledConstraints compiled;
+    compiled.Build(sysd);
+
+    int nc = sysd.CountActiveConstraints();
+    ASSERT_EQ(compiled.GetNumConstraints(), nc);
+    ASSERT_GT(nc, 0);
+
+    ChVectorDynamic<> l(nc);
+    for (int i = 0; i < nc; i++)
+        l(i) = std::sin(1.0 + i);
+
+    ChVectorDynamic<> result(nc);
+    ChVectorDynamic<> result_ref(nc);
+    compiled.ShurComplementProduct(result, l);
+    sysd.ShurComplementProduct(result_ref, l);
+
+    ASSERT_NEAR((result - result_ref).lpNorm<Eigen::Infinity>(), 0.0, 1e-10 * result_ref.lpNorm<Eigen::Infinity>());
+}
+
+class CompiledSolverTest : public ::testing::TestWithParam<std::tuple<ChSolver::Type, bool>> {};
+
+TEST_P(CompiledSolverTest, compare) {
+    ChSolver::Type solver_type = std::get<0>(GetParam());
+    bool rolling = std::get<1>(GetParam());
+
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_compiled;
+    CreateSystem(sys_ref, solver_type, false, rolling);
+    CreateSystem(sys_compiled, solver_type, true, rolling);
+
+    for (int step = 0; step < 5; step++) {
+        sys_ref.DoStepDynamics(1e-2);
+        sys_compiled.DoStepDynamics(1e-2);
+    }
+
+    ASSERT_EQ(sys_ref.GetNcontacts(), sys_compiled.GetNcontacts());
+
+    auto& bodies_ref = sys_ref.Get_bodylist();
+    auto& bodies_compiled = sys_compiled.Get_bodylist();
+    for (size_t i = 0; i < bodies_ref.size(); i++) {
+        ASSERT_NEAR((bodies_ref[i]->GetPos_dt() - bodies_compiled[i]->GetPos_dt()).Length(), 0.0, 1e-6);
+        ASSERT_NEAR((bodies_ref[i]->GetWvel_par() - bodies_compiled[i]->GetWvel_par()).Length(), 0.0, 1e-6);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChIterativeSolverVI,
+                         CompiledSolverTest,
+                         ::testing::Combine(::testing::Values(ChSolver::Type::PSOR, ChSolver::Type::APGD),
+                                            ::testing::Bool()));
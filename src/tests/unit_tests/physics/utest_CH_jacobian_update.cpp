@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the Newton matrix update methods of implicit timesteppers.
+// A double pendulum is simulated with a direct sparse solver and the number of
+// calls to the solver's Setup function (i.e., Jacobian evaluations and
+// factorizations) is checked for each JacobianUpdate method.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+using namespace chrono;
+
+using JacobianUpdate = ChImplicitIterativeTimestepper::JacobianUpdate;
+
+struct Counts {
+    int steps;
+    int iterations;
+    int setups;
+};
+
+static Counts Simulate(ChTimestepper::Type type, JacobianUpdate method) {
+    ChSystemNSC sys;
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < 2; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetMass(1);
+        body->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+        body->SetPos(ChVector<>(1.0 + 2 * i, 0, 0));
+        sys.AddBody(body);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(2.0 * i, 0, 0), QUNIT));
+        sys.AddLink(joint);
+
+        prev = body;
+    }
+
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+    sys.SetTimestepperType(type);
+
+    auto stepper = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys.GetTimestepper());
+    stepper->SetJacobianUpdateMethod(method);
+    stepper->SetMaxiters(20);
+    stepper->SetAbsTolerances(1e-8);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper()))
+        hht->SetStepControl(false);
+
+    Counts counts = {0, 0, 0};
+    for (int step = 0; step < 100; step++) {
+        sys.DoStepDynamics(1e-3);
+        counts.steps++;
+        counts.iterations += stepper->GetNumIterations();
+        counts.setups += stepper->GetNumSetupCalls();
+    }
+
+    return counts;
+}
+
+class JacobianUpdateTest : public ::testing::TestWithParam<ChTimestepper::Type> {};
+
+TEST_P(JacobianUpdateTest, every_iteration) {
+    auto counts = Simulate(GetParam(), JacobianUpdate::EVERY_ITERATION);
+    std::cout << "steps: " << counts.steps << "  iterations: " << counts.iterations << "  setups: " << counts.setups
+              << std::endl;
+    ASSERT_EQ(counts.setups, counts.iterations);
+}
+
+TEST_P(JacobianUpdateTest, every_step) {
+    auto counts = Simulate(GetParam(), JacobianUpdate::EVERY_STEP);
+    std::cout << "steps: " << counts.steps << "  iterations: " << counts.iterations << "  setups: " << counts.setups
+              << std::endl;
+    ASSERT_LE(counts.setups, counts.steps);
+    ASSERT_GE(counts.setups, counts.steps - 1);
+}
+
+TEST_P(JacobianUpdateTest, automatic) {
+    auto counts = Simulate(GetParam(), JacobianUpdate::AUTOMATIC);
+    std::cout << "steps: " << counts.steps << "  iterations: " << counts.iterations << "  setups: " << counts.setups
+              << std::endl;
+    ASSERT_GE(counts.setups, 1);
+    ASSERT_LT(counts.setups, counts.steps);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChImplicitIterativeTimestepper,
+                         JacobianUpdateTest,
+                         ::testing::Values(ChTimestepper::Type::EULER_IMPLICIT,
+                                           ChTimestepper::Type::TRAPEZOIDAL,
+                                           ChTimestepper::Type::TRAPEZOIDAL_LINEARIZED,
+                                           ChTimestepper::Type::NEWMARK,
+                                           ChTimestepper::Type::HHT));
@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the PSOR solver with colored parallel sweeps.
+// The velocities obtained with ChSolverPSORcolored for a system with stacked
+// spheres (frictional contacts) and pendulums (bilateral joints) are compared
+// to those obtained with ChSolverPSOR.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
+
+using namespace chrono;
+
+static void CreateSystem(ChSystemNSC& sys, ChSolver::Type solver_type) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetSolverType(solver_type);
+    sys.SetSolverMaxIterations(5000);
+    sys.SetSolverTolerance(1e-12);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.3f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.5));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    // Stacks of spheres, initially in contact and moving downwards
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            for (int k = 0; k < 3; k++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, true, true, mat);
+                ball->SetPos(ChVector<>(-3.0 + 2 * i, -3.0 + 2 * j, 0.5 + k));
+                ball->SetPos_dt(ChVector<>(0, 0, -0.1 * (k + 1)));
+                sys.AddBody(ball);
+            }
+        }
+    }
+
+    // Pendulums attached to the ground
+    for (int i = 0; i < 3; i++) {
+        auto bob = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 1, 100, true, false);
+        bob->SetPos(ChVector<>(6, -2.0 + 2 * i, 4.5));
+        bob->SetPos_dt(ChVector<>(0, 0.5, 0));
+        sys.AddBody(bob);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(ground, bob, ChCoordsys<>(ChVector<>(6, -2.0 + 2 * i, 5), Q_from_AngY(CH_C_PI_2)));
+        sys.AddLink(joint);
+    }
+}
+
+TEST(ChSolverPSORcolored, compare_PSOR) {
+    ChSystemNSC sys_psor;
+    ChSystemNSC sys_colored;
+    CreateSystem(sys_psor, ChSolver::Type::PSOR);
+    CreateSystem(sys_colored, ChSolver::Type::PSOR_COLORED);
+
+    auto solver = std::dynamic_pointer_cast<ChSolverPSORcolored>(sys_colored.GetSolver());
+    ASSERT_TRUE(solver);
+
+    for (int step = 0; step < 5; step++) {
+        sys_psor.DoStepDynamics(1e-2);
+        sys_colored.DoStepDynamics(1e-2);
+    }
+
+    // The contact graph (stacks of three spheres) requires more than one color
+    ASSERT_GT(solver->GetNumColors(), 1);
+    ASSERT_EQ(sys_psor.GetNcontacts(), sys_colored.GetNcontacts());
+
+    auto& bodies_psor = sys_psor.Get_bodylist();
+    auto& bodies_colored = sys_colored.Get_bodylist();
+    ASSERT_EQ(bodies_psor.size(), bodies_colored.size());
+    for (size_t i = 0; i < bodies_psor.size(); i++) {
+        ASSERT_NEAR((bodies_psor[i]->GetPos_dt() - bodies_colored[i]->GetPos_dt()).Length(), 0.0, 1e-6);
+        ASSERT_NEAR((bodies_psor[i]->GetWvel_par() - bodies_colored[i]->GetWvel_par()).Length(), 0.0, 1e-6);
+        ASSERT_NEAR((bodies_psor[i]->GetPos() - bodies_colored[i]->GetPos()).Length(), 0.0, 1e-8);
+    }
+}
@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+//  This project simulates a box resting on a horizontal plate and pushed by a
+//  constant horizontal force. With the MultiStep tangential displacement model,
+//  the tangential displacement accumulated over the contact history provides
+//  static friction: the box sticks if the force is below the Coulomb limit and
+//  slides with the kinetic friction deceleration otherwise.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#define SMC_SEQUENTIAL
+#include "../utest_SMC.h"
+
+// Test system parameterized by SMC contact force model
+class TangentialHistoryTest : public ::testing::TestWithParam<ChSystemSMC::ContactForceModel> {
+  protected:
+    TangentialHistoryTest() {
+        auto fmodel = GetParam();
+
+        // Create a shared material to be used by the all bodies
+        float y_modulus = 2.0e5f;  // Default 2e5
+        float p_ratio = 0.3f;      // Default 0.3f
+        s_frict = 0.5f;            // Usually in 0.1 range, rarely above. Default 0.6f
+        float k_frict = 0.5f;      // Default 0.6f
+        float cor_in = 0.0f;       // Default 0.4f
+
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        mat->SetYoungModulus(y_modulus);
+        mat->SetPoissonRatio(p_ratio);
+        mat->SetSfriction(s_frict);
+        mat->SetKfriction(k_frict);
+        mat->SetRestitution(cor_in);
+        mat->SetAdhesion(0);
+
+        // Create an SMC system and set the system parameters
+        sys = new ChSystemSMC();
+        time_step = 2.0E-5;
+        gravity = -9.81;
+        SetSimParameters(sys, ChVector<>(0, gravity, 0), fmodel, ChSystemSMC::TangentialDisplacementModel::MultiStep);
+
+        sys->SetNumThreads(2);
+
+        // Add the wall to the system
+        double wmass = 10.0;
+        ChVector<> wsize(8, 1, 3);
+        ChVector<> wpos(0, -wsize.y() / 2 - 0.5, 0);
+        ChVector<> init_wv(0, 0, 0);
+
+        AddWall(-1, sys, mat, wsize, wmass, wpos, init_wv, true);
+
+        // Add the block to the system
+        bmass = 1.0;
+        ChVector<> bsize(0.5, 0.5, 0.5);
+        ChVector<> bpos(0, bsize.y() / 2 - 0.49, 0);
+        ChVector<> init_bv(0, 0, 0);
+
+        body = AddWall(0, sys, mat, bsize, bmass, bpos, init_bv, false);
+
+        // Let the block settle on the plate
+        double t_end = 2;
+        while (sys->GetChTime() < t_end) {
+            sys->DoStepDynamics(time_step);
+
+            if (CalcKE(sys, 1.0E-9)) {
+                std::cout << "[settling] KE falls below threshold after " << sys->GetChTime() << " s\n";
+                break;
+            }
+        }
+    }
+
+    ~TangentialHistoryTest() { delete sys; }
+
+    // Push the block with the given horizontal force for the given duration.
+    void Push(double force, double duration) {
+        double t_end = sys->GetChTime() + duration;
+        while (sys->GetChTime() < t_end) {
+            body->Empty_forces_accumulators();
+            body->Accumulate_force(ChVector<>(force, 0, 0), body->GetPos(), false);
+            sys->DoStepDynamics(time_step);
+        }
+    }
+
+    ChSystemSMC* sys;
+    std::shared_ptr<ChBody> body;
+    double bmass;
+    double time_step;
+    double gravity;
+    float s_frict;
+};
+
+TEST_P(TangentialHistoryTest, stick) {
+    double init_pos = body->GetPos().x();
+
+    // Push with half the Coulomb limit; the block must not slide
+    Push(0.5 * s_frict * bmass * std::abs(gravity), 0.5);
+
+    double d_sim = body->GetPos().x() - init_pos;
+    double v_sim = body->GetPos_dt().x();
+    std::cout << ForceModel_name(GetParam()) << "  displacement: " << d_sim << "  velocity: " << v_sim << "\n";
+    ASSERT_LT(std::abs(d_sim), 1e-3);
+    ASSERT_LT(std::abs(v_sim), 1e-3);
+}
+
+TEST_P(TangentialHistoryTest, slide) {
+    // Push with twice the Coulomb limit; the block must slide with acceleration (F - mu * m * g) / m
+    double duration = 0.2;
+    Push(2 * s_frict * bmass * std::abs(gravity), duration);
+
+    double v_ref = s_frict * std::abs(gravity) * duration;
+    double v_sim = body->GetPos_dt().x();
+    double v_err = std::abs((v_ref - v_sim) / v_ref) * 100;
+    std::cout << ForceModel_name(GetParam()) << "  " << v_ref << "  " << v_sim << "  " << v_err << "\n";
+    ASSERT_LT(v_err, 2.0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSequential,
+                         TangentialHistoryTest,
+                         ::testing::Values(ChSystemSMC::ContactForceModel::Hooke,
+                                           ChSystemSMC::ContactForceModel::Hertz));